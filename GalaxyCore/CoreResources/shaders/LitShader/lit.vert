@@ -11,12 +11,13 @@ out vec3 tangent;
 
 uniform mat4 MVP;
 uniform mat4 Model;
+uniform mat4 NormalMatrix;
 
 void main()
 {
     gl_Position = MVP * vec4(aPos, 1.0f);
     pos = vec3(Model * vec4(aPos, 1.0f)); 
-	normal = vec3(Model * vec4(aNor, 0.0f));
+	normal = mat3(NormalMatrix) * aNor;
     tangent = vec3(Model * vec4(aTan, 0.0f));
     uv = aTex;
 }
\ No newline at end of file
@@ -1,9 +0,0 @@
-#version 450 core
-out vec4 FragColor;
-
-uniform vec4 idColor;
-
-void main()
-{
-    FragColor = idColor;
-}
\ No newline at end of file
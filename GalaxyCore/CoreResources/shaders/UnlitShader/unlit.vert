@@ -9,6 +9,7 @@ out vec3 viewDir; // Changed from viewPos to viewDir
 
 uniform mat4 MVP;
 uniform mat4 Model;
+uniform mat4 NormalMatrix;
 uniform vec3 ViewPos;
 
 void main()
@@ -16,7 +17,7 @@ void main()
 
   vec3 worldPosition = vec3(Model * vec4(aPos, 1.0));
   vec3 T = normalize(mat3(Model) * aTan);
-  vec3 N = normalize(mat3(Model) * aNor);
+  vec3 N = normalize(mat3(NormalMatrix) * aNor);
   T = normalize(T - dot(T, N) * N);
   vec3 B = cross(N, T);
 
@@ -27,6 +27,8 @@ namespace GALAXY
 
 			const char* GetComponentName() const override { return "CameraComponent"; }
 
+			inline TickFlag GetTickFlags() const override { return TickFlag::Draw; }
+
 			void OnCreate() override;
 			void OnDestroy() override;
 			void OnDraw() override;
@@ -48,6 +50,12 @@ namespace GALAXY
 
 			void SetMainCamera();
 			bool IsMainCamera() const { return m_isMainCamera; }
+#ifdef WITH_EDITOR
+			inline const Editor::EditorIcon& GetEditorIcon() const { return m_editorIcon; }
+#endif
+		protected:
+			inline void OnSettingsChanged() override { SetModified(); }
+
 		private:
 			friend Resource::Scene;
 
@@ -26,9 +26,16 @@ namespace GALAXY::Component
 		static void UnregisterComponentByName(const std::string& componentName);
 
 		static List<Shared<BaseComponent>>& GetList() { return m_componentList; }
+		// Return the registered component with this name, nullptr if there is none
+		static Shared<BaseComponent> GetWithName(const std::string& componentName);
+
+	private:
+		static void AddComponent(const Shared<BaseComponent>& component);
 
 	private:
 		static List<Shared<BaseComponent>> m_componentList;
+		// Index in the list of each component name
+		static UMap<std::string, size_t> m_nameIndices;
 	};
 
 }
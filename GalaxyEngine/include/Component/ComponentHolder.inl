@@ -4,24 +4,19 @@
 template<typename T>
 inline void Component::ComponentHolder::RegisterComponent()
 {
-	m_componentList.push_back(std::make_shared<T>());
+	AddComponent(std::make_shared<T>());
 }
 
 template<typename T>
 inline void Component::ComponentHolder::RegisterComponent(T* component)
 {
-	m_componentList.push_back(Shared<T>(component));
+	AddComponent(Shared<T>(component));
 }
 
 template<typename T>
 inline void Component::ComponentHolder::UnregisterComponent(T* component)
 {
-	for (size_t i = 0; i < m_componentList.size(); i++)
-	{
-		if (m_componentList[i].get() == component)
-		{
-			m_componentList.erase(m_componentList.begin() + i);
-			return;
-		}
-	}
+	const auto index = m_nameIndices.find(component->GetComponentName());
+	if (index != m_nameIndices.end() && m_componentList[index->second].get() == component)
+		UnregisterComponentByName(component->GetComponentName());
 }
\ No newline at end of file
@@ -0,0 +1,102 @@
+#pragma once
+#include "GalaxyAPI.h"
+#include "Utils/Type.h"
+#include "Utils/MemoryPool.h"
+
+#include <mutex>
+#include <typeindex>
+
+namespace GALAXY::Component
+{
+	class BaseComponent;
+
+	// Storage of the components of one concrete type, in chunks of fixed size slots.
+	// Slots never move so the components stay referenced by Shared and Weak handles,
+	// and iterating the components of a type reads contiguous memory
+	class GALAXY_API ComponentPoolBase
+	{
+	public:
+		using ToBaseFunction = BaseComponent* (*)(void* slot);
+
+		ComponentPoolBase(size_t slotSize, size_t slotAlignment, ToBaseFunction toBase);
+		ComponentPoolBase& operator=(const ComponentPoolBase& other) = delete;
+		ComponentPoolBase(const ComponentPoolBase&) = delete;
+		~ComponentPoolBase();
+
+		// Return the index of a free slot, the component is constructed in it by the caller
+		uint32_t Allocate();
+		// Called once the component is constructed in its slot
+		void SetAlive(uint32_t index);
+		// Called once the component is destroyed
+		void Free(uint32_t index);
+
+		inline void* GetSlot(uint32_t index) const;
+		inline size_t GetCount() const;
+		// Return one of the alive components, nullptr if the pool is empty
+		BaseComponent* GetAny();
+
+		// Call func(BaseComponent*) for every alive component, in memory order
+		template<typename F>
+		inline void ForEach(F&& func);
+
+		// Return the pool of the given type, created on first use and shared by every module
+		static ComponentPoolBase* Get(const std::type_index& type, size_t slotSize, size_t slotAlignment, ToBaseFunction toBase);
+		static List<ComponentPoolBase*> GetPools();
+		// Changed every time a pool is created or replaced
+		static uint32_t GetPoolsVersion();
+
+	private:
+		static constexpr uint32_t chunkSize = 256;
+
+		struct Chunk
+		{
+			std::byte* memory = nullptr;
+			uint64_t alive[chunkSize / 64] = {};
+		};
+
+		size_t m_slotSize;
+		size_t m_slotAlignment;
+		ToBaseFunction m_toBase;
+
+		List<Chunk> m_chunks;
+		List<uint32_t> m_freeSlots;
+		size_t m_count = 0;
+		// Replaced by the pool of a reloaded script class, deleted once its last component is freed
+		bool m_retired = false;
+
+		// Components are created by the loading threads, the iteration can create and destroy components
+		std::recursive_mutex m_mutex;
+	};
+
+	// Pooled creation and iteration of the components of type T
+	template<typename T>
+	class ComponentPool
+	{
+	public:
+		// Construct a component in the pool, it goes back to the pool when its last Shared handle is released
+		template<typename... Args>
+		static inline Shared<T> Create(Args&&... args);
+
+		// Call func(T*) for every alive component of type T or derived from T
+		template<typename F>
+		static inline void ForEach(F&& func);
+
+		static inline size_t GetCount();
+
+		static inline ComponentPoolBase* GetPool();
+
+	private:
+		struct PoolCache
+		{
+			uint32_t version = 0;
+			// Pools of T or of a type derived from T
+			List<ComponentPoolBase*> pools;
+			// Pools without any component, their type is checked again on the next call
+			List<ComponentPoolBase*> unknownPools;
+		};
+
+		// Return the pools iterated by ForEach, found again only when a pool is registered or an unknown pool is used
+		static inline Shared<const PoolCache> GetMatchingPools();
+	};
+}
+#include "Component/ComponentPool.inl"
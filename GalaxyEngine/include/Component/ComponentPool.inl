@@ -0,0 +1,131 @@
+#pragma once
+#include "Component/ComponentPool.h"
+#include <algorithm>
+#include <bit>
+namespace GALAXY
+{
+	inline void* Component::ComponentPoolBase::GetSlot(const uint32_t index) const
+	{
+		return m_chunks[index / chunkSize].memory + (index % chunkSize) * m_slotSize;
+	}
+
+	inline size_t Component::ComponentPoolBase::GetCount() const
+	{
+		return m_count;
+	}
+
+	template<typename F>
+	inline void Component::ComponentPoolBase::ForEach(F&& func)
+	{
+		std::lock_guard lock(m_mutex);
+		// The alive bits are read again after every call, func can destroy components
+		for (size_t chunkIndex = 0; chunkIndex < m_chunks.size(); chunkIndex++)
+		{
+			for (uint32_t word = 0; word < chunkSize / 64; word++)
+			{
+				for (uint64_t bits = m_chunks[chunkIndex].alive[word]; bits != 0; bits &= bits - 1)
+				{
+					const uint32_t bit = static_cast<uint32_t>(std::countr_zero(bits));
+					if (!(m_chunks[chunkIndex].alive[word] >> bit & 1))
+						continue;
+					func(m_toBase(m_chunks[chunkIndex].memory + (word * 64 + bit) * m_slotSize));
+				}
+			}
+		}
+	}
+
+	template<typename T>
+	template<typename... Args>
+	inline Shared<T> Component::ComponentPool<T>::Create(Args&&... args)
+	{
+		ComponentPoolBase* pool = GetPool();
+		const uint32_t index = pool->Allocate();
+		T* component = new (pool->GetSlot(index)) T(std::forward<Args>(args)...);
+		pool->SetAlive(index);
+		// The control block comes from the memory pool too
+		return Shared<T>(component, [pool, index](T* pooledComponent)
+			{
+				pooledComponent->~T();
+				pool->Free(index);
+			}, Utils::PoolAllocator<T>());
+	}
+
+	template<typename T>
+	template<typename F>
+	inline void Component::ComponentPool<T>::ForEach(F&& func)
+	{
+		const Shared<const PoolCache> cache = GetMatchingPools();
+		for (ComponentPoolBase* pool : cache->pools)
+		{
+			pool->ForEach([&](BaseComponent* poolComponent)
+				{
+					func(static_cast<T*>(poolComponent));
+				});
+		}
+	}
+
+	template<typename T>
+	inline Shared<const typename Component::ComponentPool<T>::PoolCache> Component::ComponentPool<T>::GetMatchingPools()
+	{
+		static std::mutex mutex;
+		static Shared<const PoolCache> cache;
+
+		Shared<const PoolCache> current;
+		{
+			std::lock_guard lock(mutex);
+			current = cache;
+		}
+		const uint32_t version = ComponentPoolBase::GetPoolsVersion();
+		const bool sameVersion = current && current->version == version;
+		if (sameVersion && std::ranges::none_of(current->unknownPools, [](ComponentPoolBase* pool) { return pool->GetAny() != nullptr; }))
+			return current;
+
+		const Shared<PoolCache> newCache = std::make_shared<PoolCache>();
+		newCache->version = version;
+		auto addPool = [&](ComponentPoolBase* pool)
+			{
+				// Every component of a pool has the same type, one of them tells if the pool holds T
+				const BaseComponent* component = pool->GetAny();
+				if (!component)
+					newCache->unknownPools.push_back(pool);
+				else if (dynamic_cast<const T*>(component))
+					newCache->pools.push_back(pool);
+			};
+		// Only the unknown pools are checked again when no pool was registered
+		if (sameVersion)
+		{
+			newCache->pools = current->pools;
+			for (ComponentPoolBase* pool : current->unknownPools)
+			{
+				addPool(pool);
+			}
+		}
+		else
+		{
+			for (ComponentPoolBase* pool : ComponentPoolBase::GetPools())
+			{
+				addPool(pool);
+			}
+		}
+
+		std::lock_guard lock(mutex);
+		cache = newCache;
+		return newCache;
+	}
+
+	template<typename T>
+	inline size_t Component::ComponentPool<T>::GetCount()
+	{
+		return GetPool()->GetCount();
+	}
+
+	template<typename T>
+	inline Component::ComponentPoolBase* Component::ComponentPool<T>::GetPool()
+	{
+		static ComponentPoolBase* pool = ComponentPoolBase::Get(typeid(T), sizeof(T), alignof(T), [](void* slot) -> BaseComponent*
+			{
+				return static_cast<T*>(slot);
+			});
+		return pool;
+	}
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include "GalaxyAPI.h"
+#include "Utils/Type.h"
+
+#include <mutex>
+#include <typeindex>
+
+namespace GALAXY
+{
+	namespace Component
+	{
+		// Numeric ID of a component type, given the first time the type is used
+		using ComponentTypeID = uint32_t;
+		// One bit per component type, the types after the 64th get no bit
+		using ComponentMask = uint64_t;
+
+		// Registry of the component types, the IDs are the same in the engine and in the script library
+		class GALAXY_API ComponentTypes
+		{
+		public:
+			template<typename T>
+			static inline ComponentTypeID GetID();
+			// Bit of the type, 0 if it has none
+			template<typename T>
+			static inline ComponentMask GetBit();
+			// Give the name of the type the first time, so it can be found with GetBitWithName
+			template<typename T>
+			static inline ComponentMask GetBit(const char* name);
+
+			static ComponentMask GetBitWithName(const String& name);
+			static size_t GetCount();
+
+		private:
+			static ComponentTypeID Register(std::type_index type, const char* name);
+
+		private:
+			struct Type
+			{
+				std::type_index type;
+				const char* name;
+			};
+			static std::mutex s_mutex;
+			static List<Type> s_types;
+		};
+	}
+}
+#include "Component/ComponentType.inl"
@@ -0,0 +1,25 @@
+#pragma once
+#include "Component/ComponentType.h"
+namespace GALAXY
+{
+	template<typename T>
+	inline Component::ComponentTypeID Component::ComponentTypes::GetID()
+	{
+		static const ComponentTypeID id = Register(typeid(T), nullptr);
+		return id;
+	}
+
+	template<typename T>
+	inline Component::ComponentMask Component::ComponentTypes::GetBit()
+	{
+		const ComponentTypeID id = GetID<T>();
+		return id < 64 ? ComponentMask(1) << id : 0;
+	}
+
+	template<typename T>
+	inline Component::ComponentMask Component::ComponentTypes::GetBit(const char* name)
+	{
+		static const ComponentTypeID id = Register(typeid(T), name);
+		return id < 64 ? ComponentMask(1) << id : 0;
+	}
+}
@@ -16,6 +16,10 @@ namespace GALAXY
 			~DirectionalLight() override = default;
 
 			inline const char* GetComponentName() const override { return "DirectionalLight"; }
+			inline ComponentMask GetTypeMask() const override
+			{
+				return ComponentTypes::GetBit<DirectionalLight>(DirectionalLight::GetComponentName()) | Light::GetTypeMask();
+			}
 			inline virtual std::set<const char*> GetComponentNames() const override
 			{
 				std::set<const char*> list = Light::GetComponentNames();
@@ -24,7 +28,11 @@ namespace GALAXY
 			}
 
 			inline virtual Shared<Component::BaseComponent> Clone() override {
-				return std::make_shared<DirectionalLight>(*dynamic_cast<DirectionalLight*>(this));
+				return ComponentPool<DirectionalLight>::Create(*static_cast<DirectionalLight*>(this));
+			}
+
+			inline virtual Shared<Component::BaseComponent> CloneDetached() const override {
+				return std::make_shared<DirectionalLight>(*static_cast<const DirectionalLight*>(this));
 			}
 
 			void SendLightValues(Resource::Shader* shader) override;
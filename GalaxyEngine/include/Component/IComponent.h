@@ -3,12 +3,43 @@
 #include "Utils/Type.h"
 #include "Core/UUID.h"
 #include "Utils/Define.h"
+#include "Component/ComponentPool.h"
+#include "Component/ComponentType.h"
+#include "Core/Handle.h"
 
 namespace CppSer { class Serializer; class Parser; }
 namespace GALAXY {
-	namespace Core { class GameObject; }
+	namespace Core { class GameObject; class TickRegistry; }
 	namespace Component {
 
+		// Per frame callbacks of a component
+		enum class TickFlag : uint8_t
+		{
+			None = 0,
+			// OnUpdate
+			Update = 1 << 0,
+			// OnEditorUpdate
+			EditorUpdate = 1 << 1,
+			// OnDraw, OnGameDraw and OnEditorDraw
+			Draw = 1 << 2,
+		};
+		constexpr uint32_t tickGroupCount = 3;
+
+		inline constexpr TickFlag
+			operator|(const TickFlag a, const TickFlag b) {
+			return static_cast<TickFlag>(static_cast<uint8_t>(a) | static_cast<uint8_t>(b));
+		}
+
+		inline constexpr TickFlag
+			operator&(const TickFlag a, const TickFlag b) {
+			return static_cast<TickFlag>(static_cast<uint8_t>(a) & static_cast<uint8_t>(b));
+		}
+
+		inline constexpr TickFlag
+			operator~(const TickFlag a) {
+			return static_cast<TickFlag>(~static_cast<uint8_t>(a));
+		}
+
 		struct GALAXY_API ComponentID
 		{
 			Core::UUID gameObjectID;
@@ -18,15 +49,20 @@ namespace GALAXY {
 		class GALAXY_API BaseComponent
 		{
 		public:
+			using HandleBase = BaseComponent;
+
 			BaseComponent();
 			BaseComponent& operator=(const BaseComponent& other) = default;
 			BaseComponent(const BaseComponent&) = default;
 			BaseComponent(BaseComponent&&) noexcept = default;
-			virtual ~BaseComponent() {}
+			virtual ~BaseComponent();
 
 			// Return the component name
 			inline virtual const char* GetComponentName() const { return "BaseComponent"; }
 
+			// Bits of the component type and of the component types it derives from
+			inline virtual ComponentMask GetTypeMask() const { return 0; }
+
 			// Return the list of component names
 			inline virtual std::set<const char*> GetComponentNames() const {
 				std::set<const char*> names;
@@ -37,6 +73,9 @@ namespace GALAXY {
 
 			virtual void ShowInInspector() {}
 
+			// Return the per frame callbacks the scene calls on this component, the other ones are never called by the scene
+			inline virtual TickFlag GetTickFlags() const { return TickFlag::None; }
+
 			// Called on Creation
 			virtual void OnCreate() {}
 
@@ -89,15 +128,48 @@ namespace GALAXY {
 
 			// ========= Setters ========= //
 
-			inline void SetSelfEnable(const bool enable) { p_enable = enable; }
+			void SetSelfEnable(bool enable);
+
+			// Report a change of a serialized value to the gameobject and its scene
+			void SetModified() const;
+
+			// Stop or resume the given per frame callbacks, only the flags returned by GetTickFlags can be resumed
+			void SetTickEnabled(TickFlag flags, bool enable);
+			inline bool IsTickEnabled(TickFlag flag) const { return (GetTickFlags() & ~p_tick.disabled & flag) != TickFlag::None; }
 
 			virtual Shared<BaseComponent> Clone() = 0;
+			// Copy outside of the component pools, never iterated by the scene systems
+			virtual Shared<BaseComponent> CloneDetached() const = 0;
+
+			// Table of the component handles, shared by every component type
+			static Core::HandleTable& GetHandleTable();
 
 		protected:
 			friend Core::GameObject;
+			friend Core::TickRegistry;
+
+			// Register in the tick lists of the scene of the gameobject, or unregister if there is none
+			void UpdateTickRegistration();
+			void ClearTickRegistration();
+
+			// Registration in the tick lists of a scene, a copy of the component is not registered
+			struct TickState
+			{
+				TickState() = default;
+				TickState(const TickState& other) : disabled(other.disabled) {}
+				TickState& operator=(const TickState&) { return *this; }
+
+				Core::TickRegistry* registry = nullptr;
+				uint32_t indices[tickGroupCount] = { INDEX_NONE, INDEX_NONE, INDEX_NONE };
+				TickFlag disabled = TickFlag::None;
+			};
 
 			Core::GameObject* p_gameObject = nullptr;
 
+			TickState p_tick;
+
+			Core::HandleEntry p_handle;
+
 			bool p_enable = true;
 
 			uint32_t p_id = -1;
@@ -107,15 +179,31 @@ namespace GALAXY {
 		class GALAXY_API IComponent : public BaseComponent
 		{
 		public:
+			// Component type this interface was created for, the classes deriving from it without their own interface share it
+			using ComponentClass = Derived;
+
 			IComponent() = default;
 			IComponent& operator=(const IComponent& other) = default;
 			IComponent(const IComponent&) = default;
 			IComponent(IComponent&&) noexcept = default;
 			~IComponent() override = default;
 
+			// Return a handle to this component, valid until the component is destroyed
+			inline Core::Handle<Derived> GetHandle() const {
+				return p_handle.Get<Derived>(GetHandleTable(), const_cast<BaseComponent*>(static_cast<const BaseComponent*>(this)));
+			}
+
+			inline ComponentMask GetTypeMask() const override {
+				return ComponentTypes::GetBit<Derived>(static_cast<const Derived*>(this)->Derived::GetComponentName());
+			}
+
 			// Clone the component
 			inline virtual Shared<BaseComponent> Clone() override {
-				return std::make_shared<Derived>(*dynamic_cast<Derived*>(this));
+				return ComponentPool<Derived>::Create(*static_cast<Derived*>(this));
+			}
+
+			inline virtual Shared<BaseComponent> CloneDetached() const override {
+				return std::make_shared<Derived>(*static_cast<const Derived*>(this));
 			}
 
 			// Reset All the value of the component.
@@ -134,5 +222,33 @@ namespace GALAXY {
 
 			};
 
+		// True if the mask of every component of type T, derived types included, contains the bit of T
+		template<typename T>
+		constexpr bool hasOwnTypeMask = std::is_same_v<decltype(&T::GetTypeMask), ComponentMask (T::*)() const>
+			|| std::is_same_v<decltype(&T::GetTypeMask), ComponentMask (IComponent<T>::*)() const>;
+
+		// Return true if the component is a T. The types without their own mask, like the scripts,
+		// are cast once the components are filtered with the bit of their interface
+		template<typename T>
+		inline bool IsComponentOf(const BaseComponent* component)
+		{
+			if constexpr (std::is_same_v<T, BaseComponent>)
+			{
+				return true;
+			}
+			else if constexpr (hasOwnTypeMask<T>)
+			{
+				if (const ComponentMask bit = ComponentTypes::GetBit<T>())
+					return (component->GetTypeMask() & bit) != 0;
+				return dynamic_cast<const T*>(component) != nullptr;
+			}
+			else
+			{
+				const ComponentMask bit = ComponentTypes::GetBit<typename T::ComponentClass>();
+				if (bit != 0 && (component->GetTypeMask() & bit) == 0)
+					return false;
+				return dynamic_cast<const T*>(component) != nullptr;
+			}
+		}
 		}
 	}
\ No newline at end of file
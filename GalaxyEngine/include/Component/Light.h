@@ -40,6 +40,8 @@ namespace GALAXY
 
 			inline const char* GetComponentName() const override { return "Light Component"; }
 
+			inline TickFlag GetTickFlags() const override { return TickFlag::Draw; }
+
 			virtual void OnCreate() override;
 
 			virtual void OnDestroy() override;
@@ -57,13 +59,13 @@ namespace GALAXY
 			virtual void ComputeLocationName();
 
 			inline Vec4f GetAmbient() const { return p_ambient.value; }
-			inline void SetAmbient(const Vec4f val) { p_ambient.value = val; SetDirty(); }
+			inline void SetAmbient(const Vec4f val) { p_ambient.value = val; SetDirty(); SetModified(); }
 
 			inline Vec4f GetDiffuse() const { return p_diffuse.value; }
-			inline void SetDiffuse(const Vec4f val) { p_diffuse.value = val; SetDirty(); }
+			inline void SetDiffuse(const Vec4f val) { p_diffuse.value = val; SetDirty(); SetModified(); }
 
 			inline Vec4f GetSpecular() const { return p_specular.value; }
-			inline void SetSpecular(const Vec4f val) { p_specular.value = val; SetDirty(); }
+			inline void SetSpecular(const Vec4f val) { p_specular.value = val; SetDirty(); SetModified(); }
 
 			inline virtual Type GetLightType() { return Type::None; };
 
@@ -72,6 +74,9 @@ namespace GALAXY
 
 			inline bool IsDirty() const { return p_dirty; }
 			inline void SetDirty() { p_dirty = true; }
+#ifdef WITH_EDITOR
+			inline const Editor::EditorIcon& GetEditorIcon() const { return m_editorIcon; }
+#endif
 		protected:
 			size_t p_lightIndex = -1;
 
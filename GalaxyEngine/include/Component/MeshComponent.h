@@ -1,9 +1,11 @@
 #pragma once
 #include "GalaxyAPI.h"
 #include "IComponent.h"
+#include "Physic/AABB.h"
 
 namespace GALAXY {
 	namespace Resource { class Mesh; class Material; }
+	namespace Core { class BoundsRegistry; }
 	namespace Component
 	{
 		class GALAXY_API MeshComponent : public IComponent<MeshComponent>
@@ -14,11 +16,17 @@ namespace GALAXY {
 
 			inline const char* GetComponentName() const override { return "MeshComponent"; }
 
+			inline TickFlag GetTickFlags() const override { return TickFlag::Draw; }
+
 			void OnDraw() override;
 
-			inline void SetMesh(const Weak<Resource::Mesh>& mesh) { if (mesh.lock()) { m_mesh = mesh; } }
+			inline void SetMesh(const Weak<Resource::Mesh>& mesh) { if (mesh.lock()) { m_mesh = mesh; SetModified(); } }
 			inline Weak<Resource::Mesh> GetMesh() const { return m_mesh; }
 
+			// The occluders are rasterized on the CPU to hide the meshes behind them, like the walls of a level
+			inline void SetOccluder(const bool occluder) { m_occluder = occluder; SetModified(); }
+			inline bool IsOccluder() const { return m_occluder; }
+
 			void Serialize(CppSer::Serializer& serializer) override;
 			void Deserialize(CppSer::Parser& parser) override;
 
@@ -29,10 +37,29 @@ namespace GALAXY {
 
 			void ShowInInspector() override;
 		private:
+			friend Core::BoundsRegistry;
+
+			// World box of the mesh, cached by the scene while the transform and the mesh do not change
+			Physic::AABB GetWorldBounds(const Resource::Mesh* mesh) const;
+			bool IsInFrustum(const Resource::Mesh* mesh, const Physic::Frustum& frustum) const;
+
+			// Index of the component in the bounds registry of its scene, a copy is not registered
+			struct BoundsSlot
+			{
+				BoundsSlot() = default;
+				BoundsSlot(const BoundsSlot&) {}
+				BoundsSlot& operator=(const BoundsSlot&) { return *this; }
+
+				uint32_t index = INDEX_NONE;
+			};
+
 			Weak<Resource::Mesh> m_mesh;
 			List<Weak<Resource::Material>> m_materials;
 
+			BoundsSlot m_boundsSlot;
+
 			bool m_drawBoundingBox = false;
+			bool m_occluder = false;
 		};
 	}
 }
@@ -16,6 +16,10 @@ namespace GALAXY
 			~PointLight() override {}
 
 			inline const char* GetComponentName() const override { return "PointLight"; }
+			inline ComponentMask GetTypeMask() const override
+			{
+				return ComponentTypes::GetBit<PointLight>(PointLight::GetComponentName()) | Light::GetTypeMask();
+			}
 			inline virtual std::set<const char*> GetComponentNames() const override
 			{
 				std::set<const char*> list = Light::GetComponentNames();
@@ -24,7 +28,11 @@ namespace GALAXY
 			}
 
 			inline virtual Shared<Component::BaseComponent> Clone() override {
-				return std::make_shared<PointLight>(*dynamic_cast<PointLight*>(this));
+				return ComponentPool<PointLight>::Create(*static_cast<PointLight*>(this));
+			}
+
+			inline virtual Shared<Component::BaseComponent> CloneDetached() const override {
+				return std::make_shared<PointLight>(*static_cast<const PointLight*>(this));
 			}
 			
 			inline Type GetLightType() override { return Light::Type::Point; };
@@ -34,13 +42,13 @@ namespace GALAXY
 			void ShowInInspector() override;
 
 			inline float GetConstant() const { return p_constant.value; }
-			inline void SetConstant(const float val) { p_constant.value = val; SetDirty(); }
+			inline void SetConstant(const float val) { p_constant.value = val; SetDirty(); SetModified(); }
 
 			inline float GetLinear() const { return p_linear.value; }
-			inline void SetLinear(const float val) { p_linear.value = val; SetDirty(); }
+			inline void SetLinear(const float val) { p_linear.value = val; SetDirty(); SetModified(); }
 
 			inline float GetQuadratic() const { return p_quadratic.value; }
-			inline void SetQuadratic(const float val) { p_quadratic.value = val; SetDirty(); }
+			inline void SetQuadratic(const float val) { p_quadratic.value = val; SetDirty(); SetModified(); }
 
 			void ComputeLocationName() override;
 
@@ -32,6 +32,9 @@ namespace GALAXY
 				return list;
 			}
 
+			// Scripts can override it to skip the callbacks they do not use
+			inline TickFlag GetTickFlags() const override { return TickFlag::Update | TickFlag::EditorUpdate; }
+
 			virtual void ShowInInspector() override;
 			/*
 
@@ -70,6 +73,7 @@ namespace GALAXY
 			inline void SetVariable(const std::string& variableName, T value)
 			{
 				Scripting::ScriptEngine::GetInstance()->SetScriptVariable<T>(this, GetComponentName(), variableName, value);
+				SetModified();
 			}
 
 			void Serialize(CppSer::Serializer& serializer) override;
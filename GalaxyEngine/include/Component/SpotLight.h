@@ -17,6 +17,10 @@ namespace GALAXY
 			~SpotLight() override {}
 
 			inline const char* GetComponentName() const override { return "SpotLight"; }
+			inline ComponentMask GetTypeMask() const override
+			{
+				return ComponentTypes::GetBit<SpotLight>(SpotLight::GetComponentName()) | Light::GetTypeMask();
+			}
 			inline virtual std::set<const char*> GetComponentNames() const override
 			{
 				std::set<const char*> list = Light::GetComponentNames();
@@ -25,7 +29,11 @@ namespace GALAXY
 			}
 
 			inline virtual Shared<Component::BaseComponent> Clone() override {
-				return std::make_shared<SpotLight>(*dynamic_cast<SpotLight*>(this));
+				return ComponentPool<SpotLight>::Create(*static_cast<SpotLight*>(this));
+			}
+
+			inline virtual Shared<Component::BaseComponent> CloneDetached() const override {
+				return std::make_shared<SpotLight>(*static_cast<const SpotLight*>(this));
 			}
 
 			void OnEditorDraw() override;
@@ -41,10 +49,10 @@ namespace GALAXY
 			void Serialize(CppSer::Serializer& serializer) override;
 			void Deserialize(CppSer::Parser& parser) override;
 
-			inline void SetCutOff(const float angle) { m_cutOff.value = angle; SetDirty(); }
+			inline void SetCutOff(const float angle) { m_cutOff.value = angle; SetDirty(); SetModified(); }
 			inline float GetCutOff() const { return m_cutOff.value; }
 
-			inline void SetOuterCutOff(const float angle) { m_outerCutOff = angle; SetDirty(); }
+			inline void SetOuterCutOff(const float angle) { m_outerCutOff = angle; SetDirty(); SetModified(); }
 			inline float GetOuterCutOff() const { return m_outerCutOff.value; }
 		private:
 			LightData<Vec3f> m_direction;
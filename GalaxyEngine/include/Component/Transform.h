@@ -5,6 +5,8 @@
 
 #include "Utils/Event.h"
 
+#include "Core/TransformHierarchy.h"
+
 namespace GALAXY {
 	enum class Space
 	{
@@ -17,10 +19,10 @@ namespace GALAXY {
 		public:
 			Transform();
 			Transform(const Vec3f& position, const Quat& rotation, const Vec3f& scale = Vec3f(1.f));
-			Transform& operator=(const Transform& other) = default;
-			Transform(const Transform&) = default;
-			Transform(Transform&&) noexcept = default;
-			~Transform() override = default;
+			// Copies are not registered in the hierarchy of the scene
+			Transform& operator=(const Transform& other);
+			Transform(const Transform& other);
+			~Transform() override;
 
 			void OnUpdate() override;
 			void ForceUpdate();
@@ -34,6 +36,8 @@ namespace GALAXY {
 
 			void Serialize(CppSer::Serializer& serializer) override;
 			void Deserialize(CppSer::Parser& parser) override;
+			// Write the local values the same way as Serialize, for values copied from a transform
+			static void SerializeLocal(CppSer::Serializer& serializer, const Vec3f& position, const Quat& rotation, const Vec3f& scale);
 
 			// === Setters === //
 			void SetWorldPosition(const Vec3f& worldPosition);
@@ -72,9 +76,28 @@ namespace GALAXY {
 
 			inline void Rotate(Vec3f axis, float angle, Space relativeTo = Space::Local);
 
-			inline bool WasDirty() const { return m_wasDirty; }
+			// Return true if the model matrix changed during the last update
+			bool WasDirty() const;
+			// Changes every time the model matrix is computed again
+			inline uint32_t GetModelVersion() const;
 			
 			Utils::Event<> EOnUpdate;
+		private:
+			friend Core::TransformHierarchy;
+
+			// World values decomposed from the model matrix, valid while the version matches the one of the model matrix
+			struct WorldCache
+			{
+				Quat rotation;
+				Vec3f eulerRotation;
+				Vec3f scale;
+				uint32_t version = -1;
+			};
+
+			inline void SetDirty();
+
+			const WorldCache& GetWorldCache() const;
+
 		private:
 			Math::Mat4     m_modelMatrix = Math::Mat4(1);
 			Math::Vec3f    m_localPosition = Math::Vec3f();
@@ -85,6 +108,14 @@ namespace GALAXY {
 			bool m_dirty = true;
 			bool m_wasDirty = false;
 
+			// Hierarchy of the scene that stores the model matrix, the transforms outside of a scene use m_modelMatrix
+			Core::TransformHierarchy* m_hierarchy = nullptr;
+			uint32_t m_hierarchyIndex = 0;
+
+			// Incremented every time m_modelMatrix is computed
+			uint32_t m_modelVersion = 0;
+			mutable WorldCache m_worldCache;
+
 			//REFLECTION_FRIEND
 		};
 	}
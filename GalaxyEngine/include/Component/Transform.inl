@@ -5,39 +5,59 @@ namespace GALAXY
 	inline void Component::Transform::ComputeModelMatrix(const Mat4& parentMatrix)
 	{
 		m_modelMatrix = parentMatrix * GetLocalMatrix();
+		m_modelVersion++;
 		m_dirty = false;
 	}
 
 	inline void Component::Transform::ComputeModelMatrix()
 	{
 		m_modelMatrix = GetLocalMatrix();
+		m_modelVersion++;
 		m_dirty = false;
 	}
 
-	inline void Component::Transform::SetLocalPosition(const Vec3f& localPosition)
+	inline void Component::Transform::SetDirty()
 	{
 		m_dirty = true;
+		if (m_hierarchy)
+			m_hierarchy->SetDirty(m_hierarchyIndex);
+	}
+
+	inline uint32_t Component::Transform::GetModelVersion() const
+	{
+		if (m_hierarchy)
+			return m_hierarchy->GetVersion(m_hierarchyIndex);
+		return m_modelVersion;
+	}
+
+	inline void Component::Transform::SetLocalPosition(const Vec3f& localPosition)
+	{
+		SetDirty();
 		m_localPosition = localPosition;
+		SetModified();
 	}
 
 	inline void Component::Transform::SetLocalRotation(const Quat& localRotation)
 	{
-		m_dirty = true;
+		SetDirty();
 		m_localRotation = localRotation;
 		m_localEulerRotation = localRotation.ToEuler();
+		SetModified();
 	}
 
 	inline void Component::Transform::SetLocalRotation(const Vec3f& localRotation)
 	{
-		m_dirty = true;
+		SetDirty();
 		m_localEulerRotation = localRotation;
 		m_localRotation = localRotation.ToQuaternion();
+		SetModified();
 	}
 
 	inline void Component::Transform::SetLocalScale(const Vec3f& localScale)
 	{
-		m_dirty = true;
+		SetDirty();
 		m_localScale = localScale;
+		SetModified();
 	}
 
 	inline Vec3f Component::Transform::GetLocalPosition() const
@@ -67,6 +87,8 @@ namespace GALAXY
 
 	inline const Mat4& Component::Transform::GetModelMatrix() const
 	{
+		if (m_hierarchy)
+			return m_hierarchy->GetWorldMatrix(m_hierarchyIndex);
 		return m_modelMatrix;
 	}
 
@@ -10,6 +10,7 @@
 #endif
 
 #include "Core/ProjectSettings.h"
+#include "Core/ObjectSnapshot.h"
 
 #include <deque>
 #include <filesystem>
@@ -86,7 +87,7 @@ namespace GALAXY
 
 			std::deque<std::filesystem::path> m_resourceToSend;
 
-			std::string m_clipboard;
+			ObjectSnapshot m_clipboard;
 		};
 	}
 }
@@ -0,0 +1,124 @@
+#pragma once
+#include "GalaxyAPI.h"
+#include "Core/Handle.h"
+#include "Physic/AABBArray.h"
+#include "Physic/DynamicBVH.h"
+#include "Render/OcclusionBuffer.h"
+
+namespace GALAXY
+{
+	namespace Component { class MeshComponent; }
+	namespace Resource { class Scene; class Mesh; }
+	namespace Core
+	{
+		// World boxes of the mesh components of a scene, computed again only when the model matrix or the mesh changed.
+		// The boxes are stored contiguously for the batch culling and feed the spatial index of the scene
+		class GALAXY_API BoundsRegistry
+		{
+		public:
+			struct RaycastHit
+			{
+				Component::MeshComponent* component = nullptr;
+				Vec3f point;
+				float distance = 0.f;
+				// Index of the triangle in the positions of the mesh
+				uint32_t triangle = INDEX_NONE;
+			};
+
+			BoundsRegistry() = default;
+			BoundsRegistry& operator=(const BoundsRegistry& other) = delete;
+			BoundsRegistry(const BoundsRegistry&) = delete;
+			~BoundsRegistry() = default;
+
+			// Register the enabled meshes of the scene, update the boxes of the ones that changed and remove the others
+			void Update(const Resource::Scene* scene);
+
+			// Index of the box of the component drawing the mesh, INDEX_NONE if it is not registered or changed since the last update
+			uint32_t GetIndex(const Component::MeshComponent* component, const Resource::Mesh* mesh) const;
+			// Return nullptr if the component was destroyed since the last update
+			Component::MeshComponent* GetComponent(uint32_t index) const;
+
+			inline const Physic::AABBArray& GetBounds() const;
+			inline size_t GetSize() const;
+
+			// View of a camera culled by CullViews
+			struct CullView
+			{
+				Physic::Frustum frustum;
+				Mat4 viewProjection;
+				// Keeps the rejecting planes of the camera between frames, used when the view is culled alone
+				Physic::FrustumCullCache* cache = nullptr;
+			};
+			// Views culled at once, one bit of the visibility masks each
+			static constexpr uint32_t maxCullViews = 32;
+
+			// Test the boxes against every view in a single pass, the result is kept until the next cull or update and the first view is selected.
+			// Large scenes are culled through a single traversal of the spatial index.
+			// The occluders in the frustum of each view are then rasterized with its view projection and hide the boxes behind them
+			void CullViews(const List<CullView>& views);
+			// Cull a single view
+			void Cull(const Physic::Frustum& frustum, const Mat4& viewProjection, Physic::FrustumCullCache* cache = nullptr);
+			// Cull one more view beside the views of the last cull and select it, return its index.
+			// Without a cull since the last update or with every view used, the view replaces the others and its index is 0
+			uint32_t AddView(const CullView& view);
+			// Select the view read by the visibility accessors
+			inline void SetCurrentView(uint32_t view);
+			inline uint32_t GetViewCount() const;
+			// Indices of the boxes not culled in the current view, in increasing order
+			inline const List<uint32_t>& GetVisible() const;
+			// Return true if the box was tested by the last cull
+			inline bool WasCulled(uint32_t index) const;
+			inline bool IsVisible(uint32_t index) const;
+
+			// Closest triangle of the registered meshes crossed by the ray, the boxes of the spatial index select the meshes to test
+			bool Raycast(const Physic::Ray& ray, RaycastHit& hit) const;
+
+			inline void SetOcclusionCulling(bool enable);
+			inline bool IsOcclusionCullingEnabled() const;
+			// Depth of the occluders of the current view, nullptr if no view was culled
+			inline const Render::OcclusionBuffer* GetOcclusionBuffer() const;
+
+			inline Physic::DynamicBVH* GetSpatialIndex();
+			inline const Physic::DynamicBVH* GetSpatialIndex() const;
+
+		private:
+			void Add(Component::MeshComponent* component, const Resource::Mesh* mesh, const Physic::AABB& bounds);
+			// Move the last entry to the index
+			void Remove(uint32_t index);
+			// Cull the views after the ones already in the results
+			void CullNewViews(const CullView* views, uint32_t viewCount);
+			// Rasterize the occluders in the frustum of the view and remove the boxes they hide from its visible ones
+			void CullOccluded(uint32_t view, const Mat4& viewProjection);
+
+		private:
+			struct Entry
+			{
+				Handle<Component::MeshComponent> component;
+				const Resource::Mesh* mesh = nullptr;
+				// Version of the model matrix the box was computed from
+				uint32_t version = 0;
+				uint32_t proxy = INDEX_NONE;
+				bool occluder = false;
+			};
+
+			// Same order as the boxes
+			List<Entry> m_entries;
+			// Entry of each proxy of the spatial index
+			List<uint32_t> m_proxyEntries;
+			Physic::AABBArray m_bounds;
+			Physic::DynamicBVH m_spatialIndex;
+
+			// One list per view of the last cull
+			List<List<uint32_t>> m_visible;
+			List<List<uint32_t>> m_visibleProxies;
+			// One mask per box tested by the last cull, with a bit per view
+			List<uint32_t> m_visibility;
+			uint32_t m_currentView = 0;
+
+			// Kept between the frames, one per view
+			List<Shared<Render::OcclusionBuffer>> m_occlusionBuffers;
+			bool m_occlusionCulling = true;
+		};
+	}
+}
+#include "Core/BoundsRegistry.inl"
@@ -0,0 +1,65 @@
+#pragma once
+#include "Core/BoundsRegistry.h"
+namespace GALAXY
+{
+	inline const Physic::AABBArray& Core::BoundsRegistry::GetBounds() const
+	{
+		return m_bounds;
+	}
+
+	inline size_t Core::BoundsRegistry::GetSize() const
+	{
+		return m_entries.size();
+	}
+
+	inline void Core::BoundsRegistry::SetCurrentView(const uint32_t view)
+	{
+		m_currentView = view;
+	}
+
+	inline uint32_t Core::BoundsRegistry::GetViewCount() const
+	{
+		return static_cast<uint32_t>(m_visible.size());
+	}
+
+	inline const List<uint32_t>& Core::BoundsRegistry::GetVisible() const
+	{
+		static const List<uint32_t> empty;
+		return m_currentView < m_visible.size() ? m_visible[m_currentView] : empty;
+	}
+
+	inline bool Core::BoundsRegistry::WasCulled(const uint32_t index) const
+	{
+		return index < m_visibility.size() && m_currentView < m_visible.size();
+	}
+
+	inline bool Core::BoundsRegistry::IsVisible(const uint32_t index) const
+	{
+		return (m_visibility[index] >> m_currentView & 1u) != 0;
+	}
+
+	inline void Core::BoundsRegistry::SetOcclusionCulling(const bool enable)
+	{
+		m_occlusionCulling = enable;
+	}
+
+	inline bool Core::BoundsRegistry::IsOcclusionCullingEnabled() const
+	{
+		return m_occlusionCulling;
+	}
+
+	inline const Render::OcclusionBuffer* Core::BoundsRegistry::GetOcclusionBuffer() const
+	{
+		return m_currentView < m_visible.size() ? m_occlusionBuffers[m_currentView].get() : nullptr;
+	}
+
+	inline Physic::DynamicBVH* Core::BoundsRegistry::GetSpatialIndex()
+	{
+		return &m_spatialIndex;
+	}
+
+	inline const Physic::DynamicBVH* Core::BoundsRegistry::GetSpatialIndex() const
+	{
+		return &m_spatialIndex;
+	}
+}
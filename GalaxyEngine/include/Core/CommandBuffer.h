@@ -0,0 +1,73 @@
+#pragma once
+#include "GalaxyAPI.h"
+#include "Component/IComponent.h"
+
+#include <mutex>
+
+namespace GALAXY
+{
+	namespace Resource
+	{
+		class Scene;
+	}
+	namespace Core
+	{
+		class GameObject;
+
+		// Structural changes recorded during the frame and applied together at the sync point of the scene,
+		// so objects and components are not added or removed while the scene iterates them.
+		// Commands can be recorded from any thread, they are applied in their recording order
+		class GALAXY_API CommandBuffer
+		{
+		public:
+			CommandBuffer() = default;
+			CommandBuffer& operator=(const CommandBuffer& other) = delete;
+			CommandBuffer(const CommandBuffer&) = delete;
+			~CommandBuffer() = default;
+
+			// The object is created now, it is added to the parent or to the root of the scene when applied
+			Shared<GameObject> CreateObject(const String& name = "GameObject", const Weak<GameObject>& parent = {});
+			// Destroy the object with its children, the destroyed objects that follow each other are destroyed in one batch
+			void Destroy(const Weak<GameObject>& object);
+			void SetParent(const Weak<GameObject>& object, const Weak<GameObject>& parent);
+
+			// The component is created now, it is added and its OnCreate is called when applied
+			template<typename T>
+			inline Weak<T> AddComponent(const Weak<GameObject>& object);
+			void RemoveComponent(const Weak<Component::BaseComponent>& component);
+
+			// Apply the commands, the ones recorded while applying are applied too
+			void Execute(Resource::Scene* scene);
+
+			size_t GetCount() const;
+
+		private:
+			enum class CommandType
+			{
+				CreateObject,
+				Destroy,
+				SetParent,
+				AddComponent,
+				RemoveComponent,
+			};
+
+			struct Command
+			{
+				CommandType type;
+				Weak<GameObject> object;
+				Weak<GameObject> parent;
+				// Created by the command, owned by it until it is applied
+				Shared<GameObject> createdObject;
+				Shared<Component::BaseComponent> createdComponent;
+				Weak<Component::BaseComponent> component;
+			};
+
+			void Record(Command&& command);
+
+		private:
+			mutable std::mutex m_mutex;
+			List<Command> m_commands;
+		};
+	}
+}
+#include "Core/CommandBuffer.inl"
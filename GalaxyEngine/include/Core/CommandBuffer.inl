@@ -0,0 +1,17 @@
+#pragma once
+#include "Core/CommandBuffer.h"
+namespace GALAXY
+{
+	template<typename T>
+	inline Weak<T> Core::CommandBuffer::AddComponent(const Weak<GameObject>& object)
+	{
+		static_assert(std::is_base_of_v<Component::BaseComponent, T>, "Incorrect Type for component");
+		Shared<T> component = Component::ComponentPool<T>::Create();
+		Command command;
+		command.type = CommandType::AddComponent;
+		command.object = object;
+		command.createdComponent = component;
+		Record(std::move(command));
+		return component;
+	}
+}
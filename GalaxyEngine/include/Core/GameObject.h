@@ -2,6 +2,8 @@
 #include "GalaxyAPI.h"
 #include "Component/Transform.h"
 #include "Core/UUID.h"
+#include "Core/Handle.h"
+#include "Utils/MemoryPool.h"
 #include <string>
 
 namespace GALAXY {
@@ -28,25 +30,73 @@ namespace GALAXY {
 	}
 	enum class DrawMode;
 	namespace Core {
+		class ObjectSnapshot;
+		class TransformHierarchy;
 		class GALAXY_API GameObject : public std::enable_shared_from_this<GameObject>
 		{
 		public:
+			using HandleBase = GameObject;
+
+			// Local transform given to each copy made by CloneMany
+			struct InstanceTransform
+			{
+				Vec3f position;
+				Quat rotation;
+				Vec3f scale = Vec3f(1.f);
+			};
+
+			// Values written by the serialization of an object without its children, copied on the main thread
+			// so the text of the object can be written on another thread
+			struct SerializedCopy
+			{
+				Weak<GameObject> object;
+				uint64_t generation = 0;
+				size_t depth = 0;
+				// Chunks of the snapshot that receive the text
+				size_t headChunk = 0;
+				size_t footerChunk = 0;
+
+				String name;
+				UUID uuid;
+				bool active = true;
+				size_t childCount = 0;
+				Vec3f position;
+				Quat rotation;
+				Vec3f scale;
+				// Clones attached to no object and out of the component pools, with the enable state of the originals
+				List<std::pair<Shared<Component::BaseComponent>, bool>> components;
+
+				Shared<const String> head;
+				Shared<const String> footer;
+			};
+
 			GameObject();
 			explicit GameObject(const String& name);
-			GameObject& operator=(const GameObject& other) = default;
-			GameObject(const GameObject&) = default;
-			GameObject(GameObject&&) noexcept = default;
+			// The transform is stored inline and points back to its object, an object is cloned with Clone
+			GameObject& operator=(const GameObject& other) = delete;
+			GameObject(const GameObject&) = delete;
+			GameObject(GameObject&&) = delete;
 			virtual ~GameObject();
 
+			// Create the object and its shared pointer control block in one block of the memory pool
+			template<typename... Args>
+			static inline Shared<GameObject> Create(Args&&... args);
+
 			void UpdateSelfAndChild() const;
 			void DrawSelfAndChild(DrawMode drawMode) const;
 
+			// The last child takes the place of the removed one, Scene::DestroyObjects removes several children in their order
 			void RemoveChild(const GameObject* child);
 			void RemoveChild(uint32_t index);
 
 			void RemoveFromParent() const;
 
 			Shared<GameObject> Clone() const;
+			// Create count copies of the object with its children, not attached to any parent or scene.
+			// The hierarchy is flattened once and the copies are built on the worker threads,
+			// transforms is either empty or holds the local transform of each copy.
+			// Add them to a parent then call FinishDeserialize on them to create their components
+			List<Shared<GameObject>> CloneMany(size_t count, const List<InstanceTransform>& transforms = {}) const;
 
 			// This method is to use when you need to destroy over all a gameObject and all its children
 			void Destroy();
@@ -56,7 +106,12 @@ namespace GALAXY {
 			// === Setters === //
 			inline void SetName(String val);
 
+			// Bump the generation of the object and report it as modified to its scene
+			void SetModified();
+
 			void AddChild(const Shared<GameObject>& child, uint32_t index = -1);
+			// Add objects without parent at the end of the children, the scene registers them in one batch
+			void AddChildren(const List<Shared<GameObject>>& children);
 
 			// Set the parent to the given GameObject
 			void SetParent(const Weak<GameObject>& parent);
@@ -73,17 +128,28 @@ namespace GALAXY {
 			inline std::string GetName() const;
 			inline UUID GetUUID() const;
 			inline uint64_t GetSceneGraphID() const;
+			inline uint64_t GetGeneration() const;
+			// Return a handle to this object, valid until the object is destroyed
+			inline Handle<GameObject> GetHandle() const;
+			static HandleTable& GetHandleTable();
 
 			inline Component::Transform* GetTransform() const;
 			inline Shared<Core::GameObject> GetParent() const;
 
 			inline List<Weak<GameObject>> GetChildren() const;
+			// Call func(GameObject*) for every child, without copying the children list
+			template<typename F>
+			inline void ForEachChild(F&& func) const;
+			inline size_t GetChildCount() const;
 			List<Weak<GameObject>> GetAllChildren() const;
 			inline Weak<GameObject> GetChild(uint32_t index);
 
-			// Return the child index in the list of child
+			// Return the child index in the list of child, INDEX_NONE if it is not a child
 			uint32_t GetChildIndex(const GameObject* child) const;
 
+			// Check the type mask of the object, without going through its components for the engine types
+			template<typename T>
+			inline bool HasComponent() const;
 			template<typename T>
 			inline List<Weak<T>> GetComponentsInChildren();
 			template<typename T>
@@ -100,10 +166,25 @@ namespace GALAXY {
 			bool IsSibling(const List<Weak<GameObject>>& siblings) const;
 
 			void Serialize(CppSer::Serializer& serializer);
+			// Append the serialized text of the object and its children in file order. The objects changed since their last
+			// serialization are copied and get empty chunks, filled by WriteSerializedCopy from any thread
+			void GetSerializedChunks(List<Shared<const String>>& chunks, List<SerializedCopy>& copies, size_t depth = 0);
+			// Write the text of a copy made by GetSerializedChunks, without any access to the object
+			static void WriteSerializedCopy(SerializedCopy& copy);
+			// Keep the text of a written copy as the cached text of its object, unless the object changed since the copy
+			static void CacheSerializedCopy(const SerializedCopy& copy);
 			void Deserialize(CppSer::Parser& parser, bool parseUUID = true);
+			// Deserialize the object and its children without any access to the scene and without calling OnCreate,
+			// different objects can be deserialized this way at the same time from several threads
+			void DeserializeDetached(CppSer::Parser& parser, bool parseUUID = true);
+			// Link the children deserialized with DeserializeDetached to their parent and scene, then call OnCreate of the components
+			void FinishDeserialize();
 
 			inline void SetHierarchyOpen(bool val);
 
+			// Set the index of the object in the scene graph, used to find it back from the hierarchy
+			void SetSceneGraphID(uint64_t id);
+
 			inline Resource::Scene* GetScene() const;
 
 			// Call after the sceneLoading to synchronize 
@@ -123,8 +204,11 @@ namespace GALAXY {
 			friend Component::Light;
 			friend Editor::UI::Inspector;
 			friend Editor::ThumbnailCreator;
+			friend ObjectSnapshot;
+			friend TransformHierarchy;
 
 			UUID m_UUID;
+			HandleEntry m_handle;
 			uint64_t m_sceneGraphID = 0;
 			std::string m_name = "GameObject";
 
@@ -134,9 +218,14 @@ namespace GALAXY {
 			
 			Weak<GameObject> m_parent;
 			List<Shared<GameObject>> m_children;
+			// Index of the object in the children of its parent
+			mutable uint32_t m_childIndex = INDEX_NONE;
 			List<Shared<Component::BaseComponent>> m_components;
+			// Type masks of the components
+			Component::ComponentMask m_componentMask = 0;
 
-			std::unique_ptr<Component::Transform> m_transform;
+			// Stored inline, the object and its transform are one allocation
+			mutable Component::Transform m_transform;
 
 			// Hierarchy Parameters
 			friend Editor::UI::Hierarchy;
@@ -146,7 +235,26 @@ namespace GALAXY {
 
 			bool m_active = true;
 
+			// Incremented every time a serialized value of the object or one of its components changes
+			uint64_t m_generation = 0;
+			// True while the object is inside the modified list of its scene
+			bool m_modified = false;
+
+			// Cached text of the object without its children, valid for the generation and depth it was written with
+			// The strings are shared with the scene snapshots and never modified once created
+			Shared<const String> m_serializedHead;
+			Shared<const String> m_serializedFooter;
+			uint64_t m_serializedGeneration = -1;
+			size_t m_serializedDepth = -1;
+
 		private:
+			// Write the object header, transform and components
+			void SerializeHead(CppSer::Serializer& serializer);
+			// Read the object header, transform and components, return the number of children that follow
+			size_t DeserializeHead(CppSer::Parser& parser, bool parseUUID);
+			// Add a component restored from data, its OnCreate is called by FinishDeserialize
+			void AttachComponent(const Shared<Component::BaseComponent>& component);
+
 			template<typename T>
 			inline List<Shared<T>> GetComponentsPrivate();
 			template<typename T>
@@ -158,8 +266,22 @@ namespace GALAXY {
 			template<typename T>
 			inline Weak<T> GetWeakOfComponent(T* component);
 
-			// Set the scene for this object and all its children
+			// False if no component can be a T according to the type mask
+			template<typename T>
+			inline bool MayHaveComponent() const;
+
+			// Set the scene for this object and all its children, their components are registered in its tick lists
 			void SetScene(Resource::Scene* scene);
+			// Remove the components of this object and its children from the tick lists of the scene
+			void ClearTickRegistration() const;
+
+			// Append the children then the children of each child, in the order of GetAllChildren
+			void AppendAllChildren(List<Weak<GameObject>>& children) const;
+
+			// Called when the children list changed
+			void OnChildrenChanged();
+			// Store the index of the children from the given one
+			void UpdateChildIndices(uint32_t first = 0);
 		};
 
 	}
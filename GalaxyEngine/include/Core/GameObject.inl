@@ -1,6 +1,12 @@
 #pragma once
 #include "Core/GameObject.h"
 namespace GALAXY {
+	template<typename... Args>
+	inline Shared<Core::GameObject> Core::GameObject::Create(Args&&... args)
+	{
+		return std::allocate_shared<GameObject>(Utils::PoolAllocator<GameObject>(), std::forward<Args>(args)...);
+	}
+
 	inline std::string Core::GameObject::GetName() const
 	{
 		return m_name;
@@ -15,6 +21,16 @@ namespace GALAXY {
 		return m_sceneGraphID;
 	}
 
+	inline Core::Handle<Core::GameObject> Core::GameObject::GetHandle() const
+	{
+		return m_handle.Get<GameObject>(GetHandleTable(), const_cast<GameObject*>(this));
+	}
+
+	inline uint64_t Core::GameObject::GetGeneration() const
+	{
+		return m_generation;
+	}
+
 	Resource::Scene* Core::GameObject::GetScene() const
 	{
 		return m_scene;
@@ -22,7 +38,7 @@ namespace GALAXY {
 
 	inline Component::Transform* Core::GameObject::GetTransform() const
 	{
-		return m_transform.get();
+		return &m_transform;
 	}
 
 	inline Shared<Core::GameObject> Core::GameObject::GetParent() const
@@ -44,6 +60,20 @@ namespace GALAXY {
 		return weakPtrVector;
 	}
 
+	template<typename F>
+	inline void Core::GameObject::ForEachChild(F&& func) const
+	{
+		for (const Shared<GameObject>& child : m_children)
+		{
+			func(child.get());
+		}
+	}
+
+	inline size_t Core::GameObject::GetChildCount() const
+	{
+		return m_children.size();
+	}
+
 	inline Weak<Core::GameObject> Core::GameObject::GetChild(const uint32_t index)
 	{
 		if (index < m_children.size())
@@ -64,6 +94,7 @@ namespace GALAXY {
 	inline void Core::GameObject::SetName(String val)
 	{
 		m_name = std::move(val);
+		SetModified();
 	}
 
 	template<typename T>
@@ -74,7 +105,7 @@ namespace GALAXY {
 			return std::weak_ptr<T>();
 		}
 
-		Shared<T> component = std::make_shared<T>();
+		Shared<T> component = Component::ComponentPool<T>::Create();
 		AddComponent(component);
 		return component;
 	}
@@ -88,8 +119,11 @@ namespace GALAXY {
 		}
 		component->SetGameObject(this);
 		m_components.push_back(component);
+		m_componentMask |= component->GetTypeMask();
 		component->p_id = static_cast<uint32_t>(m_components.size() - 1);
+		component->UpdateTickRegistration();
 		component->OnCreate();
+		SetModified();
 	}
 
 	template<typename T>
@@ -108,13 +142,34 @@ namespace GALAXY {
 	}
 
 
+	template<typename T>
+	inline bool Core::GameObject::HasComponent() const
+	{
+		if (!MayHaveComponent<T>())
+			return false;
+		// The bit of a type with its own mask is enough
+		if constexpr (Component::hasOwnTypeMask<T> && !std::is_same_v<T, Component::BaseComponent>)
+		{
+			if (Component::ComponentTypes::GetBit<T>() != 0)
+				return true;
+		}
+		for (const Shared<Component::BaseComponent>& component : m_components)
+		{
+			if (Component::IsComponentOf<T>(component.get()))
+				return true;
+		}
+		return false;
+	}
+
 	template<typename T>
 	inline List<Weak<T>> Core::GameObject::GetComponents()
 	{
 		List<Weak<T>> list;
-		for (auto& comp : m_components) {
-			if (auto castedComp = std::dynamic_pointer_cast<T>(comp)) {
-				list.push_back(castedComp);
+		if (!MayHaveComponent<T>())
+			return list;
+		for (const Shared<Component::BaseComponent>& component : m_components) {
+			if (Component::IsComponentOf<T>(component.get())) {
+				list.push_back(std::static_pointer_cast<T>(component));
 			}
 		}
 		return list;
@@ -123,11 +178,13 @@ namespace GALAXY {
 	template<typename T>
 	inline Weak<T> Core::GameObject::GetWeakComponent()
 	{
-		for (auto& component : m_components)
+		if (!MayHaveComponent<T>())
+			return {};
+		for (const Shared<Component::BaseComponent>& component : m_components)
 		{
-			if (auto castedComponent = std::dynamic_pointer_cast<T>(component))
+			if (Component::IsComponentOf<T>(component.get()))
 			{
-				return castedComponent;
+				return std::static_pointer_cast<T>(component);
 			}
 		}
 		return {};
@@ -138,9 +195,11 @@ namespace GALAXY {
 	inline List<Shared<T>> Core::GameObject::GetComponentsPrivate()
 	{
 		List<Shared<T>> list;
-		for (auto& comp : m_components) {
-			if (auto castedComp = std::dynamic_pointer_cast<T>(comp)) {
-				list.push_back(castedComp);
+		if (!MayHaveComponent<T>())
+			return list;
+		for (const Shared<Component::BaseComponent>& component : m_components) {
+			if (Component::IsComponentOf<T>(component.get())) {
+				list.push_back(std::static_pointer_cast<T>(component));
 			}
 		}
 		return list;
@@ -169,6 +228,9 @@ namespace GALAXY {
 		component->SetGameObject(this);
 		component->p_id = index;
 		m_components.insert(m_components.begin() + index, component);
+		m_componentMask |= component->GetTypeMask();
+		component->UpdateTickRegistration();
+		SetModified();
 	}
 
 
@@ -179,12 +241,28 @@ namespace GALAXY {
 		{
 			if (componentArray.get() == component)
 			{
-				return std::dynamic_pointer_cast<T>(componentArray);
+				return std::static_pointer_cast<T>(componentArray);
 			}
 		}
 		return {};
 	}
 
+	template<typename T>
+	inline bool Core::GameObject::MayHaveComponent() const
+	{
+		if constexpr (std::is_same_v<T, Component::BaseComponent>)
+		{
+			return !m_components.empty();
+		}
+		else
+		{
+			// The types without their own mask are filtered with the bit of their interface
+			using MaskType = std::conditional_t<Component::hasOwnTypeMask<T>, T, typename T::ComponentClass>;
+			const Component::ComponentMask bit = Component::ComponentTypes::GetBit<MaskType>();
+			return bit == 0 || (m_componentMask & bit) != 0;
+		}
+	}
+
 	inline bool Core::GameObject::IsAParent(GameObject* object) const
 	{
 		if (object == this)
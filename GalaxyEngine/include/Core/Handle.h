@@ -0,0 +1,86 @@
+#pragma once
+#include "GalaxyAPI.h"
+#include "Utils/Define.h"
+
+#include <atomic>
+#include <mutex>
+
+namespace GALAXY::Core
+{
+	// Table of the objects that can be referenced by a handle, the slots of a destroyed object are reused with a new generation.
+	// Slots are stored in chunks that never move and their values are atomic, so resolving a handle never takes the lock
+	class GALAXY_API HandleTable
+	{
+	public:
+		HandleTable() = default;
+		HandleTable& operator=(const HandleTable& other) = delete;
+		HandleTable(const HandleTable&) = delete;
+		~HandleTable();
+
+		// Return the index of a new slot pointing to the object and its generation
+		uint32_t Add(void* object, uint32_t& generation);
+		// Invalidate the handles of the slot and make it available
+		void Remove(uint32_t index);
+
+		// Return the object of the slot, nullptr if the slot was removed since the handle was created
+		inline void* Resolve(uint32_t index, uint32_t generation) const;
+
+	private:
+		static constexpr uint32_t chunkBits = 12;
+		static constexpr uint32_t chunkSize = 1 << chunkBits;
+		static constexpr uint32_t maxChunkCount = 4096;
+
+		// Remove clears the object before it changes the generation and Add sets the object after,
+		// a resolve reading the generation around the object never returns the object of another generation
+		struct Slot
+		{
+			std::atomic<void*> object = nullptr;
+			std::atomic_uint32_t generation = 0;
+		};
+
+		std::atomic<Slot*> m_chunks[maxChunkCount] = {};
+		uint32_t m_size = 0;
+		List<uint32_t> m_freeSlots;
+		std::mutex m_mutex;
+	};
+
+	// Reference to an object of a handle table with a 32 bits index and a 32 bits generation.
+	// Resolving it is a bounds check and a generation compare, no reference count is touched,
+	// use it in the engine per frame code and keep Shared and Weak for the ownership
+	template<typename T>
+	struct Handle
+	{
+		uint32_t index = INDEX_NONE;
+		uint32_t generation = 0;
+
+		// Return the object, nullptr if it was destroyed
+		inline T* Get() const;
+
+		inline bool IsValid() const { return Get() != nullptr; }
+
+		bool operator==(const Handle& other) const = default;
+	};
+
+	// Slot of an object in a handle table, registered the first time a handle is requested, from any thread.
+	// A copy of the object gets its own slot
+	class HandleEntry
+	{
+	public:
+		HandleEntry() = default;
+		HandleEntry(const HandleEntry&) {}
+		HandleEntry& operator=(const HandleEntry&) { return *this; }
+		~HandleEntry() = default;
+
+		template<typename T>
+		inline Handle<T> Get(HandleTable& table, void* object) const;
+		// Called by the destructor of the object
+		inline void Release(HandleTable& table);
+
+	private:
+		static constexpr uint64_t noSlot = INDEX_NONE;
+
+		// Generation in the high bits and index in the low bits, set once by the first thread requesting a handle
+		mutable std::atomic_uint64_t m_slot = noSlot;
+	};
+}
+#include "Core/Handle.inl"
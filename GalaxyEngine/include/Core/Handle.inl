@@ -0,0 +1,55 @@
+#pragma once
+#include "Core/Handle.h"
+namespace GALAXY
+{
+	inline void* Core::HandleTable::Resolve(const uint32_t index, const uint32_t generation) const
+	{
+		if (index >> chunkBits >= maxChunkCount)
+			return nullptr;
+		const Slot* chunk = m_chunks[index >> chunkBits].load(std::memory_order_acquire);
+		if (!chunk)
+			return nullptr;
+		const Slot& slot = chunk[index & (chunkSize - 1)];
+		if (slot.generation.load(std::memory_order_acquire) != generation)
+			return nullptr;
+		void* object = slot.object.load(std::memory_order_acquire);
+		// The slot was removed and maybe reused while the object was read
+		if (slot.generation.load(std::memory_order_relaxed) != generation)
+			return nullptr;
+		return object;
+	}
+
+	template<typename T>
+	inline T* Core::Handle<T>::Get() const
+	{
+		// The table stores a pointer to the base class that owns it
+		using Base = typename T::HandleBase;
+		return static_cast<T*>(static_cast<Base*>(T::GetHandleTable().Resolve(index, generation)));
+	}
+
+	template<typename T>
+	inline Core::Handle<T> Core::HandleEntry::Get(HandleTable& table, void* object) const
+	{
+		uint64_t slot = m_slot.load(std::memory_order_acquire);
+		if (slot == noSlot)
+		{
+			uint32_t generation;
+			const uint32_t index = table.Add(object, generation);
+			const uint64_t newSlot = static_cast<uint64_t>(generation) << 32 | index;
+			// Another thread registered the object first, its slot is kept
+			if (m_slot.compare_exchange_strong(slot, newSlot, std::memory_order_acq_rel))
+				slot = newSlot;
+			else
+				table.Remove(index);
+		}
+		return { static_cast<uint32_t>(slot), static_cast<uint32_t>(slot >> 32) };
+	}
+
+	inline void Core::HandleEntry::Release(HandleTable& table)
+	{
+		const uint64_t slot = m_slot.exchange(noSlot, std::memory_order_acq_rel);
+		if (slot == noSlot)
+			return;
+		table.Remove(static_cast<uint32_t>(slot));
+	}
+}
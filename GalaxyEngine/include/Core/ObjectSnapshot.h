@@ -0,0 +1,55 @@
+#pragma once
+#include "GalaxyAPI.h"
+
+#include <vector>
+
+namespace GALAXY
+{
+	namespace Component
+	{
+		class BaseComponent;
+	}
+	namespace Core
+	{
+		class GameObject;
+
+		// Compact binary copy of GameObjects with their children, used by the clipboard and the undo history.
+		// Component values are stored once per distinct content and cloned when restored,
+		// so objects referencing the same resources share the same data
+		class GALAXY_API ObjectSnapshot
+		{
+		public:
+			ObjectSnapshot() = default;
+			explicit ObjectSnapshot(const List<Shared<GameObject>>& objects);
+			ObjectSnapshot& operator=(const ObjectSnapshot& other) = default;
+			ObjectSnapshot(const ObjectSnapshot&) = default;
+			ObjectSnapshot(ObjectSnapshot&&) noexcept = default;
+			~ObjectSnapshot() = default;
+
+			// Recreate the objects with their children, not attached to any scene.
+			// Add them to a parent then call FinishDeserialize on them to create their components.
+			// New UUIDs are generated unless keepUUID is true
+			List<Shared<GameObject>> Restore(bool keepUUID) const;
+
+			// Compress the data, it is decompressed on the fly by Restore
+			void Compress();
+
+			inline bool IsEmpty() const;
+			inline bool IsCompressed() const;
+			// Size of the snapshot in memory
+			inline size_t GetMemorySize() const;
+
+		private:
+			struct Reader;
+
+			static void WriteObject(std::vector<uint8_t>& data, GameObject* object, List<String>& payloads, UMap<String, uint32_t>& payloadIndices);
+			static Shared<GameObject> ReadObject(Reader& reader, const List<Shared<Component::BaseComponent>>& prototypes, bool keepUUID);
+
+		private:
+			std::vector<uint8_t> m_data;
+			size_t m_rawSize = 0;
+			bool m_compressed = false;
+		};
+	}
+}
+#include "Core/ObjectSnapshot.inl"
@@ -0,0 +1,19 @@
+#pragma once
+#include "Core/ObjectSnapshot.h"
+namespace GALAXY
+{
+	inline bool Core::ObjectSnapshot::IsEmpty() const
+	{
+		return m_data.empty();
+	}
+
+	inline bool Core::ObjectSnapshot::IsCompressed() const
+	{
+		return m_compressed;
+	}
+
+	inline size_t Core::ObjectSnapshot::GetMemorySize() const
+	{
+		return m_data.capacity();
+	}
+}
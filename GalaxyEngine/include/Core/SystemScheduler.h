@@ -0,0 +1,89 @@
+#pragma once
+#include "GalaxyAPI.h"
+
+#include "Utils/FileInfo.h"
+
+#include <functional>
+#include <typeindex>
+
+namespace GALAXY::Core
+{
+	// Update passes of a scene with the component types they read and write.
+	// The passes keep the order they were added in, but consecutive passes without conflicting access
+	// run at the same time on the worker threads. Passes flagged main thread run on the calling thread
+	class GALAXY_API SystemScheduler
+	{
+	public:
+		using SystemFunction = std::function<void()>;
+
+		// Returned by AddSystem to declare the access of the system
+		class SystemBuilder
+		{
+		public:
+			template<typename T>
+			inline SystemBuilder& Read();
+			template<typename T>
+			inline SystemBuilder& Write();
+			// The system can access anything, for user code
+			inline SystemBuilder& WriteAll();
+			// The system uses the renderer, ImGui or any other main thread only API
+			inline SystemBuilder& MainThread();
+
+		private:
+			friend SystemScheduler;
+			SystemBuilder(SystemScheduler* scheduler, uint32_t index) : m_scheduler(scheduler), m_index(index) {}
+
+			SystemScheduler* m_scheduler;
+			uint32_t m_index;
+		};
+
+		SystemScheduler() = default;
+		SystemScheduler& operator=(const SystemScheduler& other) = delete;
+		SystemScheduler(const SystemScheduler&) = delete;
+		~SystemScheduler() = default;
+
+		SystemBuilder AddSystem(const String& name, SystemFunction function);
+		void RemoveSystem(const String& name);
+
+		// Run every system once, from the main thread
+		void Run();
+
+		// Run the systems one after the other on the calling thread
+		inline void SetParallel(bool parallel);
+		inline bool IsParallel() const;
+
+		// Return the schedule in the graphviz format, with the duration of each system during the last run
+		String GetGraph();
+		void DumpGraph(const Path& path);
+
+	private:
+		struct System
+		{
+			String name;
+			SystemFunction function;
+			List<std::type_index> reads;
+			List<std::type_index> writes;
+			bool writeAll = false;
+			bool mainThread = false;
+
+			// Earlier systems this one has to wait for
+			List<uint32_t> dependencies;
+			double duration = 0.0;
+		};
+
+		// Return true if the two systems cannot run at the same time
+		static bool Conflict(const System& a, const System& b);
+		static void RunSystem(System& system);
+
+		// Split the systems in stages, a system goes in the stage after the last one it conflicts with
+		void Build();
+		void RunStage(const List<uint32_t>& stage);
+
+	private:
+		List<System> m_systems;
+		List<List<uint32_t>> m_stages;
+		bool m_dirty = true;
+		bool m_parallel = true;
+	};
+}
+#include "Core/SystemScheduler.inl"
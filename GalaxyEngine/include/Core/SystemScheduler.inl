@@ -0,0 +1,43 @@
+#pragma once
+#include "Core/SystemScheduler.h"
+namespace GALAXY
+{
+	template<typename T>
+	inline Core::SystemScheduler::SystemBuilder& Core::SystemScheduler::SystemBuilder::Read()
+	{
+		m_scheduler->m_systems[m_index].reads.emplace_back(typeid(T));
+		m_scheduler->m_dirty = true;
+		return *this;
+	}
+
+	template<typename T>
+	inline Core::SystemScheduler::SystemBuilder& Core::SystemScheduler::SystemBuilder::Write()
+	{
+		m_scheduler->m_systems[m_index].writes.emplace_back(typeid(T));
+		m_scheduler->m_dirty = true;
+		return *this;
+	}
+
+	inline Core::SystemScheduler::SystemBuilder& Core::SystemScheduler::SystemBuilder::WriteAll()
+	{
+		m_scheduler->m_systems[m_index].writeAll = true;
+		m_scheduler->m_dirty = true;
+		return *this;
+	}
+
+	inline Core::SystemScheduler::SystemBuilder& Core::SystemScheduler::SystemBuilder::MainThread()
+	{
+		m_scheduler->m_systems[m_index].mainThread = true;
+		return *this;
+	}
+
+	inline void Core::SystemScheduler::SetParallel(const bool parallel)
+	{
+		m_parallel = parallel;
+	}
+
+	inline bool Core::SystemScheduler::IsParallel() const
+	{
+		return m_parallel;
+	}
+}
@@ -5,6 +5,8 @@
 #include <queue>
 #include <functional>
 #include <mutex>
+#include <condition_variable>
+#include <atomic>
 
 namespace GALAXY::Core {
 	class ThreadManager
@@ -28,8 +30,57 @@ namespace GALAXY::Core {
 				std::lock_guard lock(m_mutex);
 				m_tasks.push(task_function);
 			}
+			m_taskCondition.notify_one();
 		}
 
+		// Call func(i) for every i in [0, count) on the worker threads, the calling thread takes part
+		// so it can be called from a task, return once every index is done
+		template <typename F> inline void ParallelFor(size_t count, F&& func)
+		{
+			ParallelFor(count, std::forward<F>(func), nullptr);
+		}
+
+		// Same as ParallelFor, the calling thread first runs callerWork while the worker threads start the loop
+		template <typename F> inline void ParallelFor(size_t count, F&& func, const std::function<void()>& callerWork)
+		{
+			if (count == 0)
+			{
+				if (callerWork)
+					callerWork();
+				return;
+			}
+
+			struct State
+			{
+				std::atomic_size_t next = 0;
+				std::atomic_size_t done = 0;
+			};
+			const Shared<State> state = std::make_shared<State>();
+			// Helpers starting after the end of the loop find no index left and never touch func
+			auto work = [state, count, &func]()
+				{
+					for (size_t index = state->next++; index < count; index = state->next++)
+					{
+						func(index);
+						++state->done;
+					}
+				};
+
+			// A calling thread busy with its own work leaves one more index to the helpers
+			const size_t helperCount = std::min(callerWork ? count : count - 1, m_threadList.size());
+			for (size_t i = 0; i < helperCount; i++)
+			{
+				AddTask(work);
+			}
+			if (callerWork)
+				callerWork();
+			work();
+			while (state->done.load() < count)
+				std::this_thread::yield();
+		}
+
+		inline size_t GetThreadCount() const { return m_threadList.size(); }
+
 		static void Lock();
 		static void ForceLock();
 		static void Unlock();
@@ -47,6 +98,7 @@ namespace GALAXY::Core {
 		std::queue<std::function<void()>> m_tasks = {};
 		std::vector<std::thread> m_threadList = {};
 		std::mutex m_mutex;
+		std::condition_variable m_taskCondition;
 		std::atomic_bool m_locked = false;
 		bool m_terminate = false;
 
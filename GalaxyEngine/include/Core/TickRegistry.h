@@ -0,0 +1,46 @@
+#pragma once
+#include "GalaxyAPI.h"
+#include "Component/IComponent.h"
+
+namespace GALAXY
+{
+	namespace Core
+	{
+		// Lists of the components of a scene that need a per frame callback, one list per tick flag.
+		// The scene only visits these lists, so components without callbacks cost nothing per frame
+		class GALAXY_API TickRegistry
+		{
+		public:
+			TickRegistry() = default;
+			TickRegistry& operator=(const TickRegistry& other) = delete;
+			TickRegistry(const TickRegistry&) = delete;
+			~TickRegistry();
+
+			void Register(Component::BaseComponent* component, uint32_t group);
+			void Unregister(Component::BaseComponent* component, uint32_t group);
+
+			// Call func(BaseComponent*) for every enabled component registered with the given flag.
+			// Components can register or unregister during the call, the new ones are visited on the next call
+			template<typename F>
+			inline void ForEach(Component::TickFlag flag, F&& func);
+
+			inline size_t GetCount(Component::TickFlag flag) const;
+
+			static inline uint32_t GetGroup(Component::TickFlag flag);
+
+		private:
+			// Remove the entries unregistered during an iteration
+			void Compact(uint32_t group);
+
+		private:
+			struct Group
+			{
+				List<Component::BaseComponent*> components;
+				uint32_t holes = 0;
+				uint32_t iterating = 0;
+			};
+			Group m_groups[Component::tickGroupCount];
+		};
+	}
+}
+#include "Core/TickRegistry.inl"
@@ -0,0 +1,33 @@
+#pragma once
+#include "Core/TickRegistry.h"
+#include <bit>
+namespace GALAXY
+{
+	template<typename F>
+	inline void Core::TickRegistry::ForEach(const Component::TickFlag flag, F&& func)
+	{
+		Group& group = m_groups[GetGroup(flag)];
+		group.iterating++;
+		const size_t size = group.components.size();
+		for (size_t i = 0; i < size; i++)
+		{
+			Component::BaseComponent* component = group.components[i];
+			if (component && component->IsEnable())
+				func(component);
+		}
+		group.iterating--;
+		if (group.iterating == 0 && group.holes != 0)
+			Compact(GetGroup(flag));
+	}
+
+	inline size_t Core::TickRegistry::GetCount(const Component::TickFlag flag) const
+	{
+		const Group& group = m_groups[GetGroup(flag)];
+		return group.components.size() - group.holes;
+	}
+
+	inline uint32_t Core::TickRegistry::GetGroup(const Component::TickFlag flag)
+	{
+		return static_cast<uint32_t>(std::countr_zero(static_cast<uint32_t>(flag)));
+	}
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include "GalaxyAPI.h"
+#include <galaxymath/Maths.h>
+#include <atomic>
+
+namespace GALAXY
+{
+	namespace Component
+	{
+		class Transform;
+	}
+	namespace Core
+	{
+		class GameObject;
+
+		// Matrices of every transform of a scene stored in contiguous arrays, ordered level by level from the root
+		// so a parent always comes before its children.
+		// The world matrices are updated in one linear pass over the arrays instead of a recursion over the objects
+		class GALAXY_API TransformHierarchy
+		{
+		public:
+			TransformHierarchy() = default;
+			TransformHierarchy& operator=(const TransformHierarchy& other) = delete;
+			TransformHierarchy(const TransformHierarchy&) = delete;
+			~TransformHierarchy();
+
+			// Rebuild the order if the structure changed, then update the world matrices of the dirty transforms and their children.
+			// Above the parallel threshold, each depth level is split between the worker threads
+			void Update(GameObject* root);
+
+			// Invoke the update event of the transforms updated by the last update
+			void InvokeUpdateEvents() const;
+
+			// Called when an object is added, removed or moved inside the scene, the order is rebuilt on the next update
+			inline void SetStructureDirty();
+			// Called when the local values of the transform at the given index changed
+			inline void SetDirty(uint32_t index);
+			// Called by a transform destroyed while still registered
+			void Remove(uint32_t index);
+
+			inline const Mat4& GetWorldMatrix(uint32_t index) const;
+			// Return true if the world matrix changed during the last update
+			inline bool WasUpdated(uint32_t index) const;
+			// Changes every time the world matrix at the given index is computed again
+			inline uint32_t GetVersion(uint32_t index) const;
+
+			inline size_t GetSize() const;
+			inline size_t GetLevelCount() const;
+
+			// Number of transforms to update under which the update stays on the calling thread
+			inline void SetParallelThreshold(size_t threshold);
+			inline size_t GetParallelThreshold() const;
+
+		private:
+			void Rebuild(GameObject* root);
+			// Update the transforms in [begin, end), their parents must be up to date
+			void UpdateRange(uint32_t begin, uint32_t end);
+			// Compute the local matrices of the dirty transforms in [begin, end), the range must be inside one word of the dirty bits
+			void ComposeDirty(uint32_t begin, uint32_t end);
+			void UpdateLevels();
+			// Unregister the transforms, they keep their last world matrix
+			void Clear();
+
+			static inline bool GetBit(const List<uint64_t>& bits, uint32_t index);
+			static inline void SetBit(List<uint64_t>& bits, uint32_t index);
+			// The updated bits of a level are written while the bits of the previous level are read from other threads,
+			// the word holding the end of a level and the start of the next one is accessed atomically
+			inline bool IsParentUpdated(uint32_t index);
+			inline void SetUpdated(uint32_t index);
+
+		private:
+			static constexpr uint32_t noParent = UINT32_MAX;
+
+			List<Component::Transform*> m_transforms;
+			List<uint32_t> m_parents;
+			List<Mat4> m_localMatrices;
+			List<Mat4> m_worldMatrices;
+			List<uint32_t> m_versions;
+
+			// First index of each depth level, the last value is the number of transforms
+			List<uint32_t> m_levelOffsets;
+
+			// One bit per transform
+			List<uint64_t> m_dirty;
+			List<uint64_t> m_updated;
+			// Lowest dirty index, everything before it is up to date
+			uint32_t m_firstDirty = noParent;
+			bool m_hasUpdated = false;
+			uint32_t m_version = 0;
+
+			bool m_structureDirty = true;
+
+			size_t m_parallelThreshold = 4096;
+		};
+	}
+}
+#include "Core/TransformHierarchy.inl"
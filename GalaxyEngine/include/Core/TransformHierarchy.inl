@@ -0,0 +1,75 @@
+#pragma once
+#include "Core/TransformHierarchy.h"
+namespace GALAXY
+{
+	inline void Core::TransformHierarchy::SetStructureDirty()
+	{
+		m_structureDirty = true;
+	}
+
+	inline void Core::TransformHierarchy::SetDirty(const uint32_t index)
+	{
+		SetBit(m_dirty, index);
+		m_firstDirty = std::min(m_firstDirty, index);
+	}
+
+	inline const Mat4& Core::TransformHierarchy::GetWorldMatrix(const uint32_t index) const
+	{
+		return m_worldMatrices[index];
+	}
+
+	inline bool Core::TransformHierarchy::WasUpdated(const uint32_t index) const
+	{
+		return GetBit(m_updated, index);
+	}
+
+	inline uint32_t Core::TransformHierarchy::GetVersion(const uint32_t index) const
+	{
+		return m_versions[index];
+	}
+
+	inline bool Core::TransformHierarchy::IsParentUpdated(const uint32_t index)
+	{
+		const uint32_t parent = m_parents[index];
+		if (parent == noParent)
+			return false;
+		return std::atomic_ref(m_updated[parent / 64]).load(std::memory_order_relaxed) >> (parent % 64) & 1;
+	}
+
+	inline void Core::TransformHierarchy::SetUpdated(const uint32_t index)
+	{
+		// Only one thread writes a given word, a plain read then store is enough
+		std::atomic_ref word(m_updated[index / 64]);
+		word.store(word.load(std::memory_order_relaxed) | uint64_t(1) << (index % 64), std::memory_order_relaxed);
+	}
+
+	inline size_t Core::TransformHierarchy::GetSize() const
+	{
+		return m_transforms.size();
+	}
+
+	inline size_t Core::TransformHierarchy::GetLevelCount() const
+	{
+		return m_levelOffsets.empty() ? 0 : m_levelOffsets.size() - 1;
+	}
+
+	inline void Core::TransformHierarchy::SetParallelThreshold(const size_t threshold)
+	{
+		m_parallelThreshold = threshold;
+	}
+
+	inline size_t Core::TransformHierarchy::GetParallelThreshold() const
+	{
+		return m_parallelThreshold;
+	}
+
+	inline bool Core::TransformHierarchy::GetBit(const List<uint64_t>& bits, const uint32_t index)
+	{
+		return bits[index / 64] >> (index % 64) & 1;
+	}
+
+	inline void Core::TransformHierarchy::SetBit(List<uint64_t>& bits, const uint32_t index)
+	{
+		bits[index / 64] |= uint64_t(1) << (index % 64);
+	}
+}
@@ -0,0 +1,20 @@
+#pragma once
+#include "GalaxyAPI.h"
+
+namespace GALAXY::Debug::Benchmark
+{
+	// Time the transform kernels against the galaxymath scalar path and the transform hierarchy against the recursive update,
+	// the results are written in the console
+	void RunTransformBenchmarks(size_t transformCount = 100000);
+
+	// Time the batch and the hierarchical frustum culling against a test of each box, for one and several cameras.
+	// The results are written in the console
+	void RunCullingBenchmarks(size_t boxCount = 1000000);
+
+	// Time the removal of the children of one object one by one, in random order, and their move to another parent.
+	// The results are written in the console, with a warning above a few milliseconds
+	void RunHierarchyBenchmarks(size_t childCount = 10000);
+
+	// Time the rasterization of walls into the occlusion buffer and the test of the boxes behind them, the results are written in the console
+	void RunOcclusionBenchmarks(size_t boxCount = 100000);
+}
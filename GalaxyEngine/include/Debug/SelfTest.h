@@ -0,0 +1,14 @@
+#pragma once
+#include "GalaxyAPI.h"
+
+namespace GALAXY::Debug::SelfTest
+{
+	// Compare every query of the spatial index with a test of each box, on a random scene whose boxes are created,
+	// moved and destroyed between the queries, including while a background rebuild runs and after it is applied.
+	// The mismatches are written in the console, return true if there was none
+	bool RunSpatialIndexTest(uint32_t seed = 0, size_t stepCount = 200);
+
+	// Compare the transform kernels, with the instruction set of the build and without vector instructions,
+	// with the matrices of galaxymath on random transforms. Return true if every difference is below the tolerance
+	bool RunTransformKernelTest(uint32_t seed = 0, size_t transformCount = 1000);
+}
@@ -4,6 +4,10 @@
 #include <functional>
 namespace GALAXY 
 {
+	namespace Core
+	{
+		class ObjectSnapshot;
+	}
 	namespace Editor
 	{
 		class Action
@@ -25,10 +29,16 @@ namespace GALAXY
 			inline void Do() const { doAction(); }
 			inline void Undo() const { undoAction(); }
 
+			// Snapshot captured by the functions, counted in the memory budget of the ActionManager
+			inline void SetSnapshot(const Shared<Core::ObjectSnapshot>& snapshot) { m_snapshot = snapshot; }
+			inline const Shared<Core::ObjectSnapshot>& GetSnapshot() const { return m_snapshot; }
+
 		private:
 			std::function<void()> doAction;
 			std::function<void()> undoAction;
 
+			Shared<Core::ObjectSnapshot> m_snapshot;
+
 		};
 	}
 }
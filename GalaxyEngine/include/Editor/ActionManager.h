@@ -3,7 +3,7 @@
 
 #include "Editor/Action.h"
 
-#include <queue>
+#include <deque>
 
 namespace GALAXY 
 {
@@ -15,7 +15,7 @@ namespace GALAXY
 		public:
 			inline ActionManager() {}
 
-			inline void AddAction(const Action& action) { undoStack.push_back(action); }
+			inline void AddAction(const Action& action) { undoStack.push_back(action); TrimHistory(); }
 			inline bool CanUndo() const {
 				return !undoStack.empty();
 			}
@@ -26,6 +26,11 @@ namespace GALAXY
 
 			void Update();
 
+			// Maximum memory used by the snapshots of the history, the oldest actions are removed above it
+			inline void SetMemoryBudget(const size_t budget) { m_memoryBudget = budget; TrimHistory(); }
+			inline size_t GetMemoryBudget() const { return m_memoryBudget; }
+			size_t GetMemoryUsage() const;
+
 			inline void Undo() {
 				if (CanUndo()) {
 					const Action action = undoStack.back();
@@ -45,8 +50,14 @@ namespace GALAXY
 			}
 
 		private:
-			std::vector<Action> undoStack;
-			std::vector<Action> redoStack;
+			// Compress the older snapshots and remove the oldest actions above the memory budget
+			void TrimHistory();
+
+		private:
+			std::deque<Action> undoStack;
+			std::deque<Action> redoStack;
+
+			size_t m_memoryBudget = 256ull * 1024 * 1024;
 		};
 	}
 }
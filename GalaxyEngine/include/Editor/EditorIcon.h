@@ -1,6 +1,7 @@
 #pragma once
 #include "GalaxyAPI.h"
 #include "Utils/Type.h"
+#include "Physic/Ray.h"
 namespace GALAXY 
 {
 	namespace Resource
@@ -22,9 +23,12 @@ namespace GALAXY
 
 			void SetIconTexture(const Weak<Resource::Texture>& iconTexture) const;
 
-			void Render(uint64_t id = -1);
+			void Render();
 
 			void SetPosition(const Vec3f& position);
+
+			// Return true if the ray crosses the billboard facing the camera with the given axes, the distance is set to the hit
+			bool Raycast(const Physic::Ray& ray, const Vec3f& cameraUp, const Vec3f& cameraRight, float& distance) const;
 		private:
 			Weak<Resource::Mesh> m_plane;
 			Shared<Resource::Material> m_material;
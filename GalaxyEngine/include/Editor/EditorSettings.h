@@ -67,6 +67,10 @@ namespace GALAXY
 			[[nodiscard]] ScriptEditorTool GetScriptEditorTool() const { return m_scriptEditorTool; }
 			void SetScriptEditorTool(const ScriptEditorTool val) { m_scriptEditorTool = val; }
 
+			[[nodiscard]] bool IsAutoSaveEnable() const { return m_autoSave; }
+			// Interval in seconds between two background saves of the current scene
+			[[nodiscard]] float GetAutoSaveInterval() const { return m_autoSaveInterval; }
+
 			void SaveSettings() const;
 			void LoadSettings();
 		private:
@@ -90,6 +94,9 @@ namespace GALAXY
 			ScriptEditorTool m_scriptEditorTool = ScriptEditorTool::VisualStudioCode;
 #endif
 			Weak<Resource::Texture> m_projectThumbnail = {};
+
+			bool m_autoSave = false;
+			float m_autoSaveInterval = 300.f;
 		};
 	}
 }
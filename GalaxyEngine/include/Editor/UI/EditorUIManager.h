@@ -33,6 +33,9 @@ namespace GALAXY::Editor::UI {
 
 		void DrawUI();
 
+		// Save the current scene in background when the auto save interval is elapsed
+		void UpdateAutoSave();
+
 		void DPIChangeCallback(const Vec2f& pos);
 
 		// Scale the UI based on the current DPI, called before each frame
@@ -76,7 +79,10 @@ namespace GALAXY::Editor::UI {
 
 		bool m_shouldUpdateDPIScale = true;
 		float m_prevDPIScale = 0.0f;
+		Utils::EventSubscription m_dpiChangeSubscription;
 
 		std::set<Core::UUID> m_loadingResources;
+
+		double m_lastAutoSaveTime = 0.0;
 	};
 }
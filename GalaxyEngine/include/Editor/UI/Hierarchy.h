@@ -23,6 +23,9 @@ namespace GALAXY {
 
 			void SetRename(Core::GameObject* gameObject);
 
+			// Destroy the selected objects, the deletion can be undone
+			void DestroySelected() const;
+
 		private:
 			friend class MainBar;
 
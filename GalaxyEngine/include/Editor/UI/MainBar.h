@@ -1,5 +1,6 @@
 #pragma once
 #include "GalaxyAPI.h"
+#include "Utils/Event.h"
 namespace GALAXY 
 {
 	namespace Resource
@@ -15,13 +16,16 @@ namespace GALAXY
 
 			void Draw();
 
-			static void SaveScene(std::string path);
+			// Save the current scene, from a worker thread when async is true
+			static void SaveScene(std::string path, bool async = true);
 
 			static void OpenScene(const std::string& path);
 
 			void AddModelToScene() const;
 		private:
 			Weak<Resource::Model> m_waitingModel;
+			// Add the waiting model once loaded, replaced when another model is picked before
+			Utils::EventSubscription m_modelLoadSubscription;
 		};
 	}
 }
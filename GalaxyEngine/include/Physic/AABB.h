@@ -0,0 +1,39 @@
+#pragma once
+#include "GalaxyAPI.h"
+#include "Physic/Frustum.h"
+#include "Physic/Ray.h"
+namespace GALAXY
+{
+	namespace Physic {
+		// Axis aligned box in world space
+		struct AABB
+		{
+			Vec3f min = Vec3f(FLT_MAX);
+			Vec3f max = Vec3f(-FLT_MAX);
+
+			AABB() = default;
+			AABB(const Vec3f& _min, const Vec3f& _max) : min(_min), max(_max) {}
+
+			inline Vec3f GetCenter() const;
+			inline Vec3f GetExtents() const;
+			inline float GetSurfaceArea() const;
+			inline bool IsValid() const;
+
+			inline AABB Merge(const AABB& other) const;
+			// Grow every side by the size of the box times the ratio
+			inline AABB Enlarge(float ratio) const;
+			// Box holding this one once transformed by the affine matrix
+			inline AABB Transform(const Mat4& matrix) const;
+
+			inline bool Contains(const AABB& other) const;
+			inline bool Intersects(const AABB& other) const;
+			inline bool IntersectsSphere(const Vec3f& center, float radius) const;
+			// Return false if the box is completely behind one of the planes
+			inline bool IntersectsFrustum(const Frustum& frustum) const;
+			// Distance along the ray where it enters the box, the ray scale is its length.
+			// Return false if the ray misses the box
+			inline bool IntersectsRay(const Ray& ray, float& distance) const;
+		};
+	}
+}
+#include "Physic/AABB.inl"
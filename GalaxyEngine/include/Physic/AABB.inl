@@ -0,0 +1,118 @@
+#pragma once
+#include "Physic/AABB.h"
+namespace GALAXY
+{
+	inline Vec3f Physic::AABB::GetCenter() const
+	{
+		return (min + max) * 0.5f;
+	}
+
+	inline Vec3f Physic::AABB::GetExtents() const
+	{
+		return (max - min) * 0.5f;
+	}
+
+	inline float Physic::AABB::GetSurfaceArea() const
+	{
+		const Vec3f size = max - min;
+		return 2.f * (size.x * size.y + size.y * size.z + size.z * size.x);
+	}
+
+	inline bool Physic::AABB::IsValid() const
+	{
+		return min.x <= max.x && min.y <= max.y && min.z <= max.z;
+	}
+
+	inline Physic::AABB Physic::AABB::Merge(const AABB& other) const
+	{
+		return {
+			Vec3f(std::min(min.x, other.min.x), std::min(min.y, other.min.y), std::min(min.z, other.min.z)),
+			Vec3f(std::max(max.x, other.max.x), std::max(max.y, other.max.y), std::max(max.z, other.max.z))
+		};
+	}
+
+	inline Physic::AABB Physic::AABB::Enlarge(const float ratio) const
+	{
+		const Vec3f margin = (max - min) * ratio;
+		return { min - margin, max + margin };
+	}
+
+	inline Physic::AABB Physic::AABB::Transform(const Mat4& matrix) const
+	{
+		// Column major, the translation is in the last column
+		const float* m = matrix.Data();
+		const Vec3f center = GetCenter();
+		const Vec3f extents = GetExtents();
+		Vec3f worldCenter;
+		Vec3f worldExtents;
+		for (int row = 0; row < 3; row++)
+		{
+			worldCenter[row] = m[12 + row] + m[row] * center.x + m[4 + row] * center.y + m[8 + row] * center.z;
+			worldExtents[row] = std::abs(m[row]) * extents.x + std::abs(m[4 + row]) * extents.y + std::abs(m[8 + row]) * extents.z;
+		}
+		return { worldCenter - worldExtents, worldCenter + worldExtents };
+	}
+
+	inline bool Physic::AABB::Contains(const AABB& other) const
+	{
+		return min.x <= other.min.x && min.y <= other.min.y && min.z <= other.min.z
+			&& max.x >= other.max.x && max.y >= other.max.y && max.z >= other.max.z;
+	}
+
+	inline bool Physic::AABB::Intersects(const AABB& other) const
+	{
+		return min.x <= other.max.x && min.y <= other.max.y && min.z <= other.max.z
+			&& max.x >= other.min.x && max.y >= other.min.y && max.z >= other.min.z;
+	}
+
+	inline bool Physic::AABB::IntersectsSphere(const Vec3f& center, const float radius) const
+	{
+		float distanceSquared = 0.f;
+		for (int i = 0; i < 3; i++)
+		{
+			const float closest = std::clamp(center[i], min[i], max[i]);
+			distanceSquared += (center[i] - closest) * (center[i] - closest);
+		}
+		return distanceSquared <= radius * radius;
+	}
+
+	inline bool Physic::AABB::IntersectsFrustum(const Frustum& frustum) const
+	{
+		const Vec3f center = GetCenter();
+		const Vec3f extents = GetExtents();
+		for (const Plane& plane : frustum.planes)
+		{
+			const float radius = extents.x * std::abs(plane.normal.x) + extents.y * std::abs(plane.normal.y) + extents.z * std::abs(plane.normal.z);
+			if (plane.GetDistanceToPlane(center) < -radius)
+				return false;
+		}
+		return true;
+	}
+
+	inline bool Physic::AABB::IntersectsRay(const Ray& ray, float& distance) const
+	{
+		float enter = 0.f;
+		float exit = ray.scale;
+		for (int i = 0; i < 3; i++)
+		{
+			if (ray.direction[i] == 0.f)
+			{
+				// Parallel to the slab
+				if (ray.origin[i] < min[i] || ray.origin[i] > max[i])
+					return false;
+				continue;
+			}
+			const float inverse = 1.f / ray.direction[i];
+			float slabEnter = (min[i] - ray.origin[i]) * inverse;
+			float slabExit = (max[i] - ray.origin[i]) * inverse;
+			if (slabEnter > slabExit)
+				std::swap(slabEnter, slabExit);
+			enter = std::max(enter, slabEnter);
+			exit = std::min(exit, slabExit);
+			if (enter > exit)
+				return false;
+		}
+		distance = enter;
+		return true;
+	}
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include "GalaxyAPI.h"
+#include "Physic/AABB.h"
+namespace GALAXY
+{
+	namespace Physic {
+		// Boxes stored one array per coordinate, so a batch of boxes is tested against a plane with contiguous loads
+		class AABBArray
+		{
+		public:
+			inline uint32_t Add(const AABB& bounds);
+			// Move the last box to the index, the boxes after it keep their index
+			inline void RemoveSwap(uint32_t index);
+			inline void Clear();
+
+			inline void Set(uint32_t index, const AABB& bounds);
+			inline AABB Get(uint32_t index) const;
+
+			inline size_t GetSize() const;
+			// Coordinate of the min or max corner of every box along the axis
+			inline const float* GetMin(int axis) const;
+			inline const float* GetMax(int axis) const;
+
+		private:
+			List<float> m_min[3];
+			List<float> m_max[3];
+		};
+	}
+}
+#include "Physic/AABBArray.inl"
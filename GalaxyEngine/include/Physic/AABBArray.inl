@@ -0,0 +1,66 @@
+#pragma once
+#include "Physic/AABBArray.h"
+namespace GALAXY
+{
+	inline uint32_t Physic::AABBArray::Add(const AABB& bounds)
+	{
+		for (int axis = 0; axis < 3; axis++)
+		{
+			m_min[axis].push_back(bounds.min[axis]);
+			m_max[axis].push_back(bounds.max[axis]);
+		}
+		return static_cast<uint32_t>(m_min[0].size() - 1);
+	}
+
+	inline void Physic::AABBArray::RemoveSwap(const uint32_t index)
+	{
+		for (int axis = 0; axis < 3; axis++)
+		{
+			m_min[axis][index] = m_min[axis].back();
+			m_min[axis].pop_back();
+			m_max[axis][index] = m_max[axis].back();
+			m_max[axis].pop_back();
+		}
+	}
+
+	inline void Physic::AABBArray::Clear()
+	{
+		for (int axis = 0; axis < 3; axis++)
+		{
+			m_min[axis].clear();
+			m_max[axis].clear();
+		}
+	}
+
+	inline void Physic::AABBArray::Set(const uint32_t index, const AABB& bounds)
+	{
+		for (int axis = 0; axis < 3; axis++)
+		{
+			m_min[axis][index] = bounds.min[axis];
+			m_max[axis][index] = bounds.max[axis];
+		}
+	}
+
+	inline Physic::AABB Physic::AABBArray::Get(const uint32_t index) const
+	{
+		return {
+			Vec3f(m_min[0][index], m_min[1][index], m_min[2][index]),
+			Vec3f(m_max[0][index], m_max[1][index], m_max[2][index])
+		};
+	}
+
+	inline size_t Physic::AABBArray::GetSize() const
+	{
+		return m_min[0].size();
+	}
+
+	inline const float* Physic::AABBArray::GetMin(const int axis) const
+	{
+		return m_min[axis].data();
+	}
+
+	inline const float* Physic::AABBArray::GetMax(const int axis) const
+	{
+		return m_max[axis].data();
+	}
+}
@@ -0,0 +1,145 @@
+#pragma once
+#include "GalaxyAPI.h"
+#include "Physic/AABB.h"
+#include "Core/Handle.h"
+
+#include <atomic>
+
+namespace GALAXY
+{
+	namespace Core { class GameObject; }
+	namespace Physic {
+		// Tree of boxes over the objects of a scene, one leaf per proxy.
+		// The leaves keep a box enlarged by a margin so small moves only refit their ancestors,
+		// the whole tree is rebuilt with the surface area heuristic once its cost went too far above the cost of the last rebuild.
+		// The queries test the exact box of the proxies, so they return the same objects as a test of every proxy
+		class GALAXY_API DynamicBVH
+		{
+		public:
+			using ObjectHandle = Core::Handle<Core::GameObject>;
+			// Frustums culled at once by CullFrustums
+			static constexpr uint32_t maxCullFrustums = 8;
+
+			DynamicBVH() = default;
+			DynamicBVH& operator=(const DynamicBVH& other) = delete;
+			DynamicBVH(const DynamicBVH&) = delete;
+			~DynamicBVH() = default;
+
+			// Return the index of the new proxy, the indices of destroyed proxies are reused
+			uint32_t CreateProxy(const AABB& bounds, ObjectHandle object);
+			void DestroyProxy(uint32_t proxy);
+			// Return true if the box left the enlarged box of the leaf and the tree was refit
+			bool MoveProxy(uint32_t proxy, const AABB& bounds);
+
+			inline const AABB& GetBounds(uint32_t proxy) const;
+			inline ObjectHandle GetObject(uint32_t proxy) const;
+			inline bool IsProxyValid(uint32_t proxy) const;
+			inline size_t GetProxyCount() const;
+
+			// Apply a finished background rebuild, and start one if the cost went above the threshold
+			void Update();
+			// Rebuild the whole tree on the calling thread
+			void Rebuild();
+			inline bool IsRebuilding() const;
+
+			void QueryFrustum(const Frustum& frustum, List<ObjectHandle>& result) const;
+			// Append the proxies in the frustum. The nodes in front of every plane accept their leaves without any test,
+			// and the plane that rejected a node is tested first on that node by the next cull with the same cache
+			void CullFrustum(const Frustum& frustum, List<uint32_t>& proxies, FrustumCullCache* cache = nullptr) const;
+			// Same as CullFrustum for several frustums in a single traversal, a node is left once every frustum rejected it.
+			// The proxies in each frustum are appended to its list, at most maxCullFrustums frustums are culled at once
+			void CullFrustums(const Frustum* frustums, uint32_t frustumCount, List<uint32_t>* proxies) const;
+			void QueryAABB(const AABB& bounds, List<ObjectHandle>& result) const;
+			void QuerySphere(const Vec3f& center, float radius, List<ObjectHandle>& result) const;
+			// Every object whose box is crossed by the ray, in no particular order
+			void QueryRay(const Ray& ray, List<ObjectHandle>& result) const;
+			// Object whose box the ray enters first, the distance is set to where the ray enters it
+			ObjectHandle RaycastClosest(const Ray& ray, float* distance = nullptr) const;
+
+			// Call callback(proxy) for every proxy whose exact box passes overlap(box), overlap is also tested on the nodes
+			template<typename Overlap, typename Callback>
+			inline void Traverse(Overlap&& overlap, Callback&& callback) const;
+
+			// Sum of the areas of the internal nodes divided by the area of the root, lower is better
+			float GetCost() const;
+			inline float GetCostAfterRebuild() const;
+			inline uint32_t GetRebuildCount() const;
+
+			// Part of the size of a box added on each side of its leaf
+			inline void SetMargin(float margin);
+			// Ratio between the current cost and the cost after the last rebuild that starts a new rebuild
+			inline void SetRebuildThreshold(float threshold);
+			// Rebuild on a worker thread, the tree stays usable until the new one is applied by Update
+			inline void SetBackgroundRebuild(bool enable);
+
+		private:
+			struct Node
+			{
+				AABB bounds;
+				uint32_t parent = INDEX_NONE;
+				uint32_t children[2] = { INDEX_NONE, INDEX_NONE };
+				// INDEX_NONE for the internal nodes
+				uint32_t proxy = INDEX_NONE;
+
+				inline bool IsLeaf() const { return children[0] == INDEX_NONE; }
+			};
+
+			struct Proxy
+			{
+				AABB bounds;
+				ObjectHandle object;
+				uint32_t leaf = INDEX_NONE;
+				bool used = false;
+			};
+
+			// Tree built from a copy of the leaves, read by the main thread only once finished is set
+			struct RebuildState
+			{
+				List<AABB> bounds;
+				List<uint32_t> proxies;
+
+				List<Node> nodes;
+				// Leaf node of each proxy of the copy
+				List<uint32_t> leaves;
+				uint32_t root = INDEX_NONE;
+				float internalArea = 0.f;
+
+				std::atomic_bool finished = false;
+			};
+
+			uint32_t AllocateNode();
+			void FreeNode(uint32_t node);
+			void InsertLeaf(uint32_t leaf);
+			void RemoveLeaf(uint32_t leaf);
+			// Recompute the boxes from the given node to the root
+			void Refit(uint32_t node);
+
+			void StartRebuild(bool background);
+			void ApplyRebuild(RebuildState& state);
+			static void Build(RebuildState& state);
+
+		private:
+			List<Node> m_nodes;
+			List<uint32_t> m_freeNodes;
+			uint32_t m_root = INDEX_NONE;
+
+			List<Proxy> m_proxies;
+			List<uint32_t> m_freeProxies;
+			size_t m_proxyCount = 0;
+
+			// Sum of the areas of the internal nodes, kept up to date by the insertions and refits
+			float m_internalArea = 0.f;
+			float m_costAfterRebuild = 0.f;
+			uint32_t m_rebuildCount = 0;
+
+			Shared<RebuildState> m_rebuild;
+			// Proxies created, destroyed or refit since the copy of the running rebuild
+			List<uint32_t> m_changedProxies;
+
+			float m_margin = 0.1f;
+			float m_rebuildThreshold = 1.5f;
+			bool m_backgroundRebuild = true;
+		};
+	}
+}
+#include "Physic/DynamicBVH.inl"
@@ -0,0 +1,80 @@
+#pragma once
+#include "Physic/DynamicBVH.h"
+namespace GALAXY
+{
+	inline const Physic::AABB& Physic::DynamicBVH::GetBounds(const uint32_t proxy) const
+	{
+		return m_proxies[proxy].bounds;
+	}
+
+	inline Physic::DynamicBVH::ObjectHandle Physic::DynamicBVH::GetObject(const uint32_t proxy) const
+	{
+		return m_proxies[proxy].object;
+	}
+
+	inline bool Physic::DynamicBVH::IsProxyValid(const uint32_t proxy) const
+	{
+		return proxy < m_proxies.size() && m_proxies[proxy].used;
+	}
+
+	inline size_t Physic::DynamicBVH::GetProxyCount() const
+	{
+		return m_proxyCount;
+	}
+
+	inline bool Physic::DynamicBVH::IsRebuilding() const
+	{
+		return m_rebuild != nullptr;
+	}
+
+	template<typename Overlap, typename Callback>
+	inline void Physic::DynamicBVH::Traverse(Overlap&& overlap, Callback&& callback) const
+	{
+		if (m_root == INDEX_NONE)
+			return;
+		List<uint32_t> stack;
+		stack.reserve(64);
+		stack.push_back(m_root);
+		while (!stack.empty())
+		{
+			const Node& node = m_nodes[stack.back()];
+			stack.pop_back();
+			if (node.IsLeaf())
+			{
+				// The leaf box is enlarged, the exact box can still miss
+				if (overlap(m_proxies[node.proxy].bounds))
+					callback(node.proxy);
+				continue;
+			}
+			if (!overlap(node.bounds))
+				continue;
+			stack.push_back(node.children[0]);
+			stack.push_back(node.children[1]);
+		}
+	}
+
+	inline float Physic::DynamicBVH::GetCostAfterRebuild() const
+	{
+		return m_costAfterRebuild;
+	}
+
+	inline uint32_t Physic::DynamicBVH::GetRebuildCount() const
+	{
+		return m_rebuildCount;
+	}
+
+	inline void Physic::DynamicBVH::SetMargin(const float margin)
+	{
+		m_margin = margin;
+	}
+
+	inline void Physic::DynamicBVH::SetRebuildThreshold(const float threshold)
+	{
+		m_rebuildThreshold = threshold;
+	}
+
+	inline void Physic::DynamicBVH::SetBackgroundRebuild(const bool enable)
+	{
+		m_backgroundRebuild = enable;
+	}
+}
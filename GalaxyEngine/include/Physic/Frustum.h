@@ -17,5 +17,11 @@ namespace GALAXY
 
 			void DebugDraw() const;
 		};
+
+		// Plane that rejected each node of a tree during the previous cull with the same camera, tested first on the next one
+		struct FrustumCullCache
+		{
+			List<uint8_t> planes;
+		};
 	}
 }
@@ -0,0 +1,18 @@
+#pragma once
+#include "GalaxyAPI.h"
+#include "Physic/AABBArray.h"
+
+// Frustum tests of arrays of boxes, using AVX or SSE when the compiler targets them.
+// A box is visible when its corner furthest along the normal of each plane is in front of the plane
+namespace GALAXY::Physic::FrustumCulling {
+	// Write the index of every visible box of [begin, end) in increasing order, return the number written
+	uint32_t CullRange(const Frustum& frustum, const AABBArray& bounds, uint32_t begin, uint32_t end, uint32_t* visible);
+
+	// Replace the list by the indices of the visible boxes in increasing order.
+	// Above the parallel threshold, the boxes are split in chunks tested on the worker threads
+	void Cull(const Frustum& frustum, const AABBArray& bounds, List<uint32_t>& visible, size_t parallelThreshold = 16384);
+
+	// Same as Cull for several frustums in a single pass over the boxes, each chunk is tested against every frustum
+	// while it is in the cache. The list of each frustum receives the indices of its visible boxes in increasing order
+	void CullViews(const Frustum* frustums, uint32_t frustumCount, const AABBArray& bounds, List<uint32_t>* visible, size_t parallelThreshold = 16384);
+}
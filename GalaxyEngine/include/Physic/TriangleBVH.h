@@ -0,0 +1,47 @@
+#pragma once
+#include "GalaxyAPI.h"
+#include "Physic/AABB.h"
+
+namespace GALAXY
+{
+	namespace Physic {
+		// Static tree of boxes over the triangles of a mesh, built once with the surface area heuristic.
+		// The triangles are stored three positions each, reordered so every leaf reads a contiguous range
+		class GALAXY_API TriangleBVH
+		{
+		public:
+			TriangleBVH() = default;
+			TriangleBVH& operator=(const TriangleBVH& other) = default;
+			TriangleBVH(const TriangleBVH&) = default;
+			TriangleBVH(TriangleBVH&&) noexcept = default;
+			~TriangleBVH() = default;
+
+			// Build the tree over three positions per triangle, the last incomplete triangle is dropped
+			void Build(List<Vec3f> positions);
+			void Clear();
+
+			// Closest triangle crossed by the ray, from either side. The distance is measured along the direction,
+			// the ray scale being the farthest distance, so a ray transformed into the space of the mesh keeps its distances
+			bool Raycast(const Ray& ray, float& distance, uint32_t* triangle = nullptr) const;
+
+			inline const List<Vec3f>& GetPositions() const;
+			inline const AABB& GetBounds() const;
+			inline size_t GetTriangleCount() const;
+			inline size_t GetNodeCount() const;
+
+		private:
+			struct Node
+			{
+				AABB bounds;
+				// First triangle of a leaf, or first of the two consecutive children of an internal node
+				uint32_t first = 0;
+				// Zero for the internal nodes
+				uint32_t count = 0;
+			};
+
+			List<Node> m_nodes;
+			List<Vec3f> m_positions;
+		};
+	}
+}
+#include "Physic/TriangleBVH.inl"
@@ -0,0 +1,25 @@
+#pragma once
+#include "Physic/TriangleBVH.h"
+namespace GALAXY
+{
+	inline const List<Vec3f>& Physic::TriangleBVH::GetPositions() const
+	{
+		return m_positions;
+	}
+
+	inline const Physic::AABB& Physic::TriangleBVH::GetBounds() const
+	{
+		static const AABB empty;
+		return m_nodes.empty() ? empty : m_nodes[0].bounds;
+	}
+
+	inline size_t Physic::TriangleBVH::GetTriangleCount() const
+	{
+		return m_positions.size() / 3;
+	}
+
+	inline size_t Physic::TriangleBVH::GetNodeCount() const
+	{
+		return m_nodes.size();
+	}
+}
@@ -62,20 +62,25 @@ namespace GALAXY
 			float GetAspectRatio() const { return p_aspectRatio; }
 
 			inline float GetFar() const { return p_far; }
-			inline void SetFar(float val) { p_far = val; }
+			inline void SetFar(float val) { p_far = val; OnSettingsChanged(); }
 
 			inline float GetNear() const { return p_near; }
-			inline void SetNear(float val) { p_near = val; }
+			inline void SetNear(float val) { p_near = val; OnSettingsChanged(); }
 
 			inline float GetFOV() const { return p_fov; }
-			inline void SetFOV(float val) { p_fov = val; }
+			inline void SetFOV(float val) { p_fov = val; OnSettingsChanged(); }
 
 			Shared<Framebuffer> GetFramebuffer() const { return p_framebuffer; }
-			void SetClearColor(const Vec4f& clearColor) { p_clearColor = clearColor; }
+			void SetClearColor(const Vec4f& clearColor) { p_clearColor = clearColor; OnSettingsChanged(); }
 
 			void CreateFrustum(); 
 
 			Physic::Frustum& GetFrustum() { return p_frustum; }
+			Physic::FrustumCullCache& GetCullCache() { return p_cullCache; }
+		protected:
+			// Called when a setting saved with the camera changed
+			virtual void OnSettingsChanged() {}
+
 		protected:
 			float p_fov = 70.f;
 			float p_far = 1000.f;
@@ -88,6 +93,7 @@ namespace GALAXY
 			Shared<Framebuffer> p_framebuffer = nullptr;
 
 			Physic::Frustum p_frustum;
+			Physic::FrustumCullCache p_cullCache;
 		};
 	}
 }
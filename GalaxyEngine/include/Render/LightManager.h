@@ -1,6 +1,7 @@
 #pragma once
 #include "GalaxyAPI.h"
 #include "Utils/Define.h"
+#include "Core/Handle.h"
 #include <array>
 
 namespace GALAXY
@@ -16,8 +17,8 @@ namespace GALAXY
 		public:
 			LightManager() {}
 
-			static bool AddLight(const Weak<Component::Light>& light);
-			static void RemoveLight(const Weak<Component::Light>& light);
+			static bool AddLight(Component::Light* light);
+			static void RemoveLight(Component::Light* light);
 
 			static void AddShader(const Weak<Resource::Shader>& shader);
 			static void RemoveShader(const Weak<Resource::Shader>& shader);
@@ -29,7 +30,8 @@ namespace GALAXY
 
 			static List<Weak<Resource::Shader>> m_shaders;
 
-			std::array<Weak<Component::Light>, MAX_LIGHT_NUMBER * 3> m_lights;
+			// Resolved every frame, a handle does not touch any reference count
+			std::array<Core::Handle<Component::Light>, MAX_LIGHT_NUMBER * 3> m_lights;
 
 		};
 	}
@@ -0,0 +1,77 @@
+#pragma once
+#include "GalaxyAPI.h"
+#include "Physic/AABB.h"
+
+namespace GALAXY
+{
+	namespace Render
+	{
+		// Depth of the occluders of a view rasterized on the CPU at a low resolution, with a hierarchical depth built from it.
+		// The boxes completely behind the occluders can be rejected before being submitted to the renderer.
+		// The depth is the normalized device depth mapped to [0, 1], rows start at the bottom of the view
+		class GALAXY_API OcclusionBuffer
+		{
+		public:
+			explicit OcclusionBuffer(uint32_t width = 256, uint32_t height = 128);
+			OcclusionBuffer& operator=(const OcclusionBuffer& other) = delete;
+			OcclusionBuffer(const OcclusionBuffer&) = delete;
+			~OcclusionBuffer() = default;
+
+			// Remove the occluders, the next occluders and tests use the view projection
+			void Begin(const Mat4& viewProjection);
+			// Add the triangles of an occluder, three model space positions per triangle. The back faces are skipped
+			void AddOccluder(const Vec3f* positions, size_t positionCount, const Mat4& modelMatrix);
+			// Rasterize the occluders, the tiles are split between the worker threads, then build the hierarchical depth
+			void End();
+
+			// Return false if the box is completely behind the occluders
+			bool IsVisible(const Physic::AABB& bounds) const;
+
+			inline uint32_t GetWidth() const;
+			inline uint32_t GetHeight() const;
+			// Depth of the pixel at the given column and row
+			inline float GetDepth(uint32_t x, uint32_t y) const;
+			inline size_t GetTriangleCount() const;
+
+		private:
+			// Triangle in pixels, with the edge and depth equations evaluated as a * x + b * y + c
+			struct Triangle
+			{
+				float edges[3][3];
+				float depth[3];
+				int minX, minY, maxX, maxY;
+			};
+
+			void AddTriangle(const Vec4f& a, const Vec4f& b, const Vec4f& c);
+			void RasterizeTile(uint32_t tile);
+			void BuildHierarchy();
+
+		private:
+			static constexpr uint32_t tileSize = 32;
+
+			uint32_t m_width;
+			uint32_t m_height;
+			// Width of a row of the depth, rounded up to a multiple of the widest vector
+			uint32_t m_stride;
+			uint32_t m_tileCountX;
+			uint32_t m_tileCountY;
+
+			Mat4 m_viewProjection;
+
+			List<Triangle> m_triangles;
+			// Triangles overlapping each tile
+			List<List<uint32_t>> m_bins;
+
+			List<float> m_depth;
+			// Farthest depth of 2^level pixels squares, starting at level 1
+			struct Level
+			{
+				uint32_t width;
+				uint32_t height;
+				List<float> depth;
+			};
+			List<Level> m_levels;
+		};
+	}
+}
+#include "Render/OcclusionBuffer.inl"
@@ -0,0 +1,24 @@
+#pragma once
+#include "Render/OcclusionBuffer.h"
+namespace GALAXY
+{
+	inline uint32_t Render::OcclusionBuffer::GetWidth() const
+	{
+		return m_width;
+	}
+
+	inline uint32_t Render::OcclusionBuffer::GetHeight() const
+	{
+		return m_height;
+	}
+
+	inline float Render::OcclusionBuffer::GetDepth(const uint32_t x, const uint32_t y) const
+	{
+		return m_depth[y * m_stride + x];
+	}
+
+	inline size_t Render::OcclusionBuffer::GetTriangleCount() const
+	{
+		return m_triangles.size();
+	}
+}
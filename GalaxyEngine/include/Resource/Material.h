@@ -36,7 +36,7 @@ namespace GALAXY
 
 			void DisplayTexture(const char* textureLabel, Weak<Texture>& textureRef) const;
 
-			Weak<Shader> SendValues(uint64_t id = -1) const;
+			Weak<Shader> SendValues() const;
 
 			static inline ResourceType GetResourceType() { return ResourceType::Material; }
 
@@ -3,6 +3,8 @@
 #include "IResource.h"
 #include "Model.h"
 
+#include "Physic/TriangleBVH.h"
+
 namespace GALAXY 
 {
 	namespace Resource { class Scene; }
@@ -31,8 +33,8 @@ namespace GALAXY
 			void Load() override;
 			void Send() override;
 
-			void Render(const Mat4& modelMatrix, const std::vector<Weak<class Material>>& materials, uint64_t id = -1) const;
-			void Render(const Mat4& modelMatrix, const std::vector<Weak<class Material>>& materials, Resource::Scene* scene, uint64_t id = -1) const;
+			void Render(const Mat4& modelMatrix, const std::vector<Weak<class Material>>& materials) const;
+			void Render(const Mat4& modelMatrix, const std::vector<Weak<class Material>>& materials, Resource::Scene* scene) const;
 
 			void DrawBoundingBox(const Component::Transform* transform) const;
 
@@ -40,6 +42,12 @@ namespace GALAXY
 
 			static Path CreateMeshPath(const Path& modelPath, const Path& fileName);
 			inline Resource::BoundingBox GetBoundingBox() const { return m_boundingBox; }
+			// Model space positions kept on the CPU, three per triangle in the order of the triangle tree.
+			// They are kept for every mesh since any of them can be picked or be an occluder : 36 bytes per triangle,
+			// plus 32 bytes per node of the tree with less than two nodes per triangle, so up to 100 bytes per triangle
+			inline const std::vector<Vec3f>& GetPositions() const { return m_triangleBVH.GetPositions(); }
+			// Tree over the triangles built when the mesh is loaded, used by the picking
+			inline const Physic::TriangleBVH& GetTriangleBVH() const { return m_triangleBVH; }
 
 			Model* GetModel() const { return m_model; }
 
@@ -48,6 +56,8 @@ namespace GALAXY
 			Utils::Event<> OnLoad;
 		private:
 			void ComputeBoundingBox(const std::vector<Vec3f>& positionVertices);
+			// Build the triangle tree from the final vertices, before they are sent and released
+			void BuildTriangleBVH();
 
 		private:
 			friend Wrapper::OBJLoader;
@@ -64,6 +74,7 @@ namespace GALAXY
 
 			std::vector<Vec3i> m_indices;
 			std::vector<float> m_finalVertices;
+			Physic::TriangleBVH m_triangleBVH;
 			std::vector<SubMesh> m_subMeshes;
 		};
 	}
@@ -36,8 +36,8 @@ namespace GALAXY {
 		{
 		public:
 			explicit Model(const Path& fullPath) : IResource(fullPath) {}
-			Model& operator=(const Model& other) = default;
-			Model(const Model&) = default;
+			Model& operator=(const Model& other) = delete;
+			Model(const Model&) = delete;
 			Model(Model&&) noexcept = default;
 			~Model() override;
 
@@ -74,6 +74,8 @@ namespace GALAXY {
 
 			std::vector<Weak<class Mesh>> m_meshes;
 			std::vector<Weak<class Material>> m_materials;
+			// Unbound with the model, so a mesh loaded after its model is destroyed does not call it
+			std::vector<Utils::EventSubscription> m_meshLoadSubscriptions;
 
 			BoundingBox m_boundingBox;
 
@@ -30,10 +30,13 @@ namespace GALAXY
 
             void Load() override;
             void Send() override;
-            void Save(const Path& fullPath = "") const override;
+            void Save(const Path& fullPath = "") override;
 
             // Automaticaly add to the scene
             std::weak_ptr<Core::GameObject> Instantiate(Weak<Core::GameObject> parent = {});
+            // Instantiate count copies at once, transforms is either empty or holds the local transform of each copy.
+            // The prefab has to be loaded
+            List<Weak<Core::GameObject>> InstantiateMany(size_t count, const List<Core::GameObject::InstanceTransform>& transforms = {}, Weak<Core::GameObject> parent = {});
 
             static void CreateWith(const Path& fullPath, const std::shared_ptr<Core::GameObject>& gameObject);
             
@@ -6,6 +6,7 @@
 #include <unordered_map>
 #include <map>
 #include <filesystem>
+#include <mutex>
 
 
 namespace GALAXY {
@@ -79,7 +80,9 @@ namespace GALAXY {
 			template <typename T>
 			[[nodiscard]] inline std::vector<Weak<T>> GetAllResources();
 
+			// The map must only be read while the resource mutex is locked
 			inline ResourceMap* GetAllResourcesPtr() { return &m_resources; }
+			inline std::recursive_mutex& GetResourceMutex() { return m_resourceMutex; }
 
 			static inline Weak<class Material> GetDefaultMaterial();
 			static inline Weak<Shader> GetDefaultShader();
@@ -114,6 +117,8 @@ namespace GALAXY {
 			static Unique<Resource::ResourceManager> m_instance;
 
 			ResourceMap m_resources;
+			// Resources can be requested from several threads while loading a scene, every access to the map locks it
+			mutable std::recursive_mutex m_resourceMutex;
 			UMap<Path, Weak<IResource>> m_temporaryResources;
 
 			Weak<class Material> m_defaultMaterial;
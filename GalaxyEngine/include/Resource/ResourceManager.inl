@@ -14,6 +14,7 @@ namespace GALAXY
 {
 	inline void Resource::ResourceManager::AddResource(const Shared<IResource>& resource)
 	{
+		std::lock_guard lock(m_instance->m_resourceMutex);
 		if (m_instance->m_resources.contains(resource->GetFileInfo().GetRelativePath())) {
 			PrintWarning("Already Contain %s", resource->GetFileInfo().GetRelativePath().string().c_str());
 			return;
@@ -24,6 +25,7 @@ namespace GALAXY
 	template<typename T>
 	inline Weak<T> Resource::ResourceManager::AddResource(const Path& fullPath)
 	{
+		std::lock_guard lock(m_instance->m_resourceMutex);
 		const Path relativePath = Utils::FileInfo::ToRelativePath(fullPath);
 		if (m_instance->m_resources.contains(relativePath)) {
 			PrintWarning("Already Contain %s", relativePath.string().c_str());
@@ -39,6 +41,7 @@ namespace GALAXY
 
 	inline void Resource::ResourceManager::RemoveResource(IResource* resource)
 	{
+		std::lock_guard lock(m_resourceMutex);
 		if (!resource)
 			return;
 		if (const auto it = m_resources.find(resource->GetFileInfo().GetRelativePath());  it != m_resources.end())
@@ -61,6 +64,7 @@ namespace GALAXY
 
 	inline void Resource::ResourceManager::RemoveResource(const Path& relativePath)
 	{
+		std::lock_guard lock(m_resourceMutex);
 		if (!m_resources.contains(relativePath))
 			return;
 
@@ -72,12 +76,14 @@ namespace GALAXY
 
 	inline bool Resource::ResourceManager::Contains(const Path& fullPath) const
 	{
+		std::lock_guard lock(m_resourceMutex);
 		return m_resources.contains(fullPath);
 	}
 
 	template <typename T>
 	inline Weak<T> Resource::ResourceManager::GetOrLoad(const Path& fullPath)
 	{
+		std::lock_guard lock(m_instance->m_resourceMutex);
 		if (fullPath.empty())
 			return {};
 		const Path relativePath = Utils::FileInfo::ToRelativePath(fullPath);
@@ -119,6 +125,7 @@ namespace GALAXY
 	template <typename T>
 	Weak<T> Resource::ResourceManager::GetOrLoad(const Core::UUID& uuid)
 	{
+		std::lock_guard lock(m_instance->m_resourceMutex);
 		if (uuid == UUID_NULL)
 			return {};
 
@@ -138,6 +145,7 @@ namespace GALAXY
 	template <typename T>
 	inline Shared<T> Resource::ResourceManager::TemporaryLoad(const Path& fullPath)
 	{
+		std::lock_guard lock(m_instance->m_resourceMutex);
 		if (fullPath.empty())
 			return {};
 
@@ -182,6 +190,7 @@ namespace GALAXY
 	template <typename T>
 	inline Weak<T> Resource::ResourceManager::ReloadResource(const Path& fullPath)
 	{
+		std::lock_guard lock(m_instance->m_resourceMutex);
 		const Path relativePath = Utils::FileInfo::ToRelativePath(fullPath);
 		if (!m_instance->m_resources.contains(relativePath)) {
 			//PrintWarning("Resource %s not found in Resource Manager, Create it", relativePath.string().c_str());
@@ -198,6 +207,7 @@ namespace GALAXY
 	template<typename T>
 	inline Weak<T> Resource::ResourceManager::ReloadResource(const Core::UUID& uuid)
 	{
+		std::lock_guard lock(m_instance->m_resourceMutex);
 		if (uuid == UUID_NULL)
 			return {};
 
@@ -218,6 +228,7 @@ namespace GALAXY
 	template <typename T>
 	inline Weak<T> Resource::ResourceManager::GetResource(const Path& fullPath)
 	{
+		std::lock_guard lock(m_instance->m_resourceMutex);
 		const Path relativePath = Utils::FileInfo::ToRelativePath(fullPath);
 		if (m_instance->m_resources.contains(relativePath))
 		{
@@ -229,6 +240,7 @@ namespace GALAXY
 	template <typename T>
 	Weak<T> Resource::ResourceManager::GetResource(const Core::UUID& uuid)
 	{
+		std::lock_guard lock(m_instance->m_resourceMutex);
 		if (uuid == UUID_NULL)
 			return {};
 		auto resource = std::find_if(m_instance->m_resources.begin(), m_instance->m_resources.end(), [&](const std::pair<Path, Shared<IResource>>& _resource)
@@ -276,6 +288,7 @@ namespace GALAXY
 	template <typename T>
 	inline std::vector<Weak<T>> Resource::ResourceManager::GetAllResources()
 	{
+		std::lock_guard lock(m_resourceMutex);
 		std::vector<Weak<T>> m_resourcesOfType;
 		for (Shared<IResource>& val : m_resources | std::views::values)
 		{
@@ -311,6 +324,7 @@ namespace GALAXY
 			buttonSize = Vec2f(ImGui::GetContentRegionAvail().x, 0);
 			size_t i = 0;
 			const bool checkTypeInRange = typeFilter.size() > 0;
+			std::lock_guard lock(m_resourceMutex);
 			for (const auto& [path, resource] : m_resources)
 			{
 				bool typeChecked;
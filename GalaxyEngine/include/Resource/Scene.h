@@ -6,6 +6,8 @@
 #include "Core/GameObject.h"
 
 #include <unordered_map>
+#include <optional>
+#include <future>
 
 namespace GALAXY {
 	namespace Resource
@@ -29,6 +31,11 @@ namespace GALAXY {
 	{
 		class CameraComponent;
 	}
+	namespace Physic
+	{
+		class DynamicBVH;
+		struct Ray;
+	}
 
 	enum class DrawMode
 	{
@@ -38,9 +45,30 @@ namespace GALAXY {
 	};
 	namespace Core {
 		class SceneHolder;
+		class TickRegistry;
+		class SystemScheduler;
+		class CommandBuffer;
+		class BoundsRegistry;
+	}
+	namespace Utils {
+		class Arena;
 	}
 
 	namespace Resource {
+		// Serialized text of a scene at a given generation, the chunks are never modified once written
+		struct SceneSnapshot
+		{
+			Path path;
+			uint64_t generation = 0;
+			List<Shared<const String>> chunks;
+			// Objects changed since their last serialization, their chunks stay empty until WriteCopies
+			List<Core::GameObject::SerializedCopy> copies;
+
+			// Serialize the copied objects into their chunks, from any thread
+			void WriteCopies();
+			String GetContent() const;
+		};
+
 		class Scene : public IResource
 		{
 		public:
@@ -54,7 +82,14 @@ namespace GALAXY {
 			void Load() override;
 			void Unload() override;
 			void Send() override;
-			virtual void Save(const Path& fullPath = "") const;
+			virtual void Save(const Path& fullPath = "");
+			// Write the scene from a worker thread, the result is reported on a following update
+			void SaveAsync(const Path& fullPath = "");
+			inline bool IsSaving() const;
+
+			// Copy the modified objects and capture the cached text of the others, main thread only.
+			// The copies are serialized by WriteCopies, the snapshot is then released on the main thread
+			Shared<SceneSnapshot> CreateSnapshot(const Path& fullPath = "");
 
 			const char* GetResourceName() const override { return "Scene"; }
 
@@ -72,18 +107,33 @@ namespace GALAXY {
 			inline Weak<Core::GameObject> CreateObject(Args&&... args);
 
 			inline void AddObject(const std::shared_ptr<Core::GameObject>& gameObject);
+			// Register the objects with their children, the object list is resized once
+			void AddObjects(const List<Shared<Core::GameObject>>& objects);
 
 			inline void RemoveObject(Core::GameObject* object);
 
+			// Destroy the objects with their children, the children lists of their parents are only rebuilt once
+			void DestroyObjects(const List<Shared<Core::GameObject>>& objects);
+
 			void SetCurrentCamera(const Weak<Render::Camera>& camera);
 
 			// Call when the window should close to prevent unsaved scene
 			bool WasModified() const;
 
+			// Called by the GameObjects of the scene when one of their serialized values changed
+			void MarkModified(Core::GameObject* object);
+			// Return the objects modified since the last save or load, indexed by UUID
+			inline const UMap<Core::UUID, Weak<Core::GameObject>>& GetModifiedObjects() const;
+			// Incremented on every modification of the scene
+			inline uint64_t GetGeneration() const;
+
 			void AddCamera(const Weak<Component::CameraComponent>& camera);
 			void RemoveCamera(const Component::CameraComponent* camera);
 			void SetMainCamera(const Weak<Component::CameraComponent>& camera);
 
+			// Called by an object of the scene when its scene graph ID changed
+			void OnSceneGraphIDChanged(Core::GameObject* object, uint64_t previousID);
+
 			// Return the GameObject with the index given in scene Graph
 			inline Weak<Core::GameObject> GetWithSceneGraphID(uint64_t index);
 			// Return the GameObject with the uuid given
@@ -101,16 +151,48 @@ namespace GALAXY {
 			inline Shared<Render::EditorCamera> GetEditorCamera() const; 
 			inline Shared<Editor::Gizmo> GetGizmo() const;
 			inline Shared<Editor::ActionManager> GetActionManager() const;
+
+			// Object under the ray, the meshes are tested on their triangles and the cameras and lights on their icon
+			Shared<Core::GameObject> Pick(const Physic::Ray& ray, float* distance = nullptr) const;
 #endif
 
 			inline const UMap<Core::UUID, Shared<Core::GameObject>>& GetObjectList() const;
+			inline Core::TransformHierarchy* GetTransformHierarchy() const;
+			inline Core::TickRegistry* GetTickRegistry() const;
+			// Update passes of the scene, run every frame before the rendering
+			inline Core::SystemScheduler* GetSystemScheduler() const;
+			// Structural changes applied at the end of the update passes
+			inline Core::CommandBuffer* GetCommandBuffer() const;
+			// Temporary memory of the main thread, released at the start of every update
+			inline Utils::Arena* GetFrameArena() const;
+			// World boxes of the meshes of the scene, updated after the transforms
+			inline Core::BoundsRegistry* GetBoundsRegistry() const;
+			Physic::DynamicBVH* GetSpatialIndex() const;
 
 			Shared<Render::LightManager> GetLightManager() const { return m_lightManager; }
 		protected:
 			friend Core::SceneHolder;
 
+			// Mark the state of the given generation as the saved one
+			void ClearModified(uint64_t savedGeneration);
+			void ClearModified() { ClearModified(m_generation); }
+
+			// Add the update passes of the engine to the scheduler
+			void InitializeSystems();
+
+			// Call the draw callbacks of the components registered to draw
+			void DrawComponents(DrawMode drawMode) const;
+			// Cull the meshes against every visible camera at once, SetCurrentCamera then selects the result of its camera
+			void CullCameras();
+
+			// Cache the text of the copies in their objects and release them
+			void OnSaveFinished(SceneSnapshot& snapshot, bool success);
+			void UpdatePendingSave();
+
 			List<Weak<Component::CameraComponent>> m_cameras;
 			Weak<Render::Camera> m_currentCamera;
+			// Cameras of the views of the last cull, in the same order, only compared with the current camera
+			List<const Render::Camera*> m_culledCameras;
 			Weak<Component::CameraComponent> m_mainCamera;
 			Shared<Render::LightManager> m_lightManager = nullptr;
 
@@ -123,6 +205,30 @@ namespace GALAXY {
 			//Core::ECSystem* m_ecSystem;
 
 			UMap<Core::UUID, Shared<Core::GameObject>> m_objectList;
+			UMap<uint64_t, Weak<Core::GameObject>> m_sceneGraphIndex;
+			// Declared after the objects so it is destroyed first
+			Shared<Core::TransformHierarchy> m_transformHierarchy;
+			Shared<Core::TickRegistry> m_tickRegistry;
+			Shared<Core::SystemScheduler> m_systemScheduler;
+			Shared<Core::CommandBuffer> m_commandBuffer;
+			Shared<Utils::Arena> m_frameArena;
+			Shared<Core::BoundsRegistry> m_boundsRegistry;
+
+			uint64_t m_generation = 0;
+			uint64_t m_savedGeneration = 0;
+			UMap<Core::UUID, Weak<Core::GameObject>> m_modifiedObjects;
+			size_t m_lastSnapshotSize = 0;
+
+			struct PendingSave
+			{
+				Shared<SceneSnapshot> snapshot;
+				// Set by the worker once the file is written
+				std::promise<bool> success;
+				std::future<bool> result = success.get_future();
+			};
+			Shared<PendingSave> m_pendingSave;
+			// Save requested while another one was still writing
+			std::optional<Path> m_queuedSavePath;
 
 #ifdef WITH_EDITOR
 			Shared<Render::EditorCamera> m_editorCamera;
@@ -6,7 +6,7 @@ namespace GALAXY
 {
 	template<typename... Args> inline Weak<Core::GameObject> Resource::Scene::CreateObject(Args&&... args)
 	{
-		std::shared_ptr<Core::GameObject> shared = std::make_shared<Core::GameObject>(std::forward<Args>(args)...);
+		std::shared_ptr<Core::GameObject> shared = Core::GameObject::Create(std::forward<Args>(args)...);
 		shared->m_scene = this;
 
 		AddObject(shared);
@@ -28,34 +28,35 @@ namespace GALAXY
 			ASSERT(false);
 		}
 
-		for (auto& child : gameObject->GetChildren())
+		for (const Shared<Core::GameObject>& child : gameObject->m_children)
 		{
-			AddObject(child.lock());
+			AddObject(child);
 		}
 	}
 
 	inline void Resource::Scene::RemoveObject(Core::GameObject* object)
 	{
-		const auto shared = std::ranges::find_if(m_objectList, [&](const std::pair<uint64_t, std::shared_ptr<Core::GameObject>>& element) {
-			return element.second.get() == object; });
-		if (shared != m_objectList.end()) {
-			if (shared != m_objectList.end())
-			{
-				m_objectList.erase(shared);
-			}
-		}
+		const auto shared = m_objectList.find(object->m_UUID);
+		if (shared == m_objectList.end() || shared->second.get() != object)
+			return;
+
+		const auto sceneGraphEntry = m_sceneGraphIndex.find(object->m_sceneGraphID);
+		if (sceneGraphEntry != m_sceneGraphIndex.end() && sceneGraphEntry->second.lock().get() == object)
+			m_sceneGraphIndex.erase(sceneGraphEntry);
+		// Can destroy the object
+		m_objectList.erase(shared);
 	}
 
 	inline Weak<GALAXY::Core::GameObject> Resource::Scene::GetWithSceneGraphID(const uint64_t index)
 	{
-		for (auto& object : m_objectList | std::views::values)
-		{
-			if (object->GetSceneGraphID() == index)
-			{
-				return object;
-			}
-		}
-		return {};
+		const auto object = m_sceneGraphIndex.find(index);
+		if (object == m_sceneGraphIndex.end())
+			return {};
+		// The entry of an object that took another ID is kept until the ID is reused
+		const Shared<Core::GameObject> lockedObject = object->second.lock();
+		if (!lockedObject || lockedObject->GetSceneGraphID() != index)
+			return {};
+		return lockedObject;
 	}
 
 	inline Weak<GALAXY::Core::GameObject> Resource::Scene::GetWithUUID(const Core::UUID& uuid)
@@ -102,6 +103,51 @@ namespace GALAXY
 		return m_objectList;
 	}
 
+	inline Core::TransformHierarchy* Resource::Scene::GetTransformHierarchy() const
+	{
+		return m_transformHierarchy.get();
+	}
+
+	inline Core::TickRegistry* Resource::Scene::GetTickRegistry() const
+	{
+		return m_tickRegistry.get();
+	}
+
+	inline Core::CommandBuffer* Resource::Scene::GetCommandBuffer() const
+	{
+		return m_commandBuffer.get();
+	}
+
+	inline Utils::Arena* Resource::Scene::GetFrameArena() const
+	{
+		return m_frameArena.get();
+	}
+
+	inline Core::BoundsRegistry* Resource::Scene::GetBoundsRegistry() const
+	{
+		return m_boundsRegistry.get();
+	}
+
+	inline Core::SystemScheduler* Resource::Scene::GetSystemScheduler() const
+	{
+		return m_systemScheduler.get();
+	}
+
+	inline const UMap<Core::UUID, Weak<Core::GameObject>>& Resource::Scene::GetModifiedObjects() const
+	{
+		return m_modifiedObjects;
+	}
+
+	inline uint64_t Resource::Scene::GetGeneration() const
+	{
+		return m_generation;
+	}
+
+	inline bool Resource::Scene::IsSaving() const
+	{
+		return m_pendingSave != nullptr;
+	}
+
 #ifdef WITH_EDITOR
 	inline void Resource::Scene::RevertObject(size_t number)
 	{
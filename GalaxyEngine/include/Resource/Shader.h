@@ -32,7 +32,7 @@ namespace GALAXY {
 
 			virtual void ShowInInspector() override;
 
-			void SetVertex(const Shared<VertexShader>& vertexShader, const Weak<Shader>& weak_this, bool createVariant = true);
+			void SetVertex(const Shared<VertexShader>& vertexShader, const Weak<Shader>& weak_this);
 			void SetFragment(const Shared<FragmentShader>& fragmentShader, const Weak<Shader>& weak_this);
 			void SetGeometry(const Shared<GeometryShader>& geometryShader, const Weak<Shader>& weak_this);
 
@@ -60,7 +60,6 @@ namespace GALAXY {
 
 			static Weak<Shader> Create(const Path& path);
 
-			Weak<Shader> GetPickingVariant() const { return m_pickingVariant; }
 		protected:
 			void Serialize(CppSer::Serializer& serializer) const override;
 			void Deserialize(CppSer::Parser& parser) override;
@@ -78,8 +77,6 @@ namespace GALAXY {
 			friend Wrapper::Renderer;
 			friend Wrapper::OpenGLRenderer;
 			friend class BaseShader;
-
-			Shared<Shader> m_pickingVariant;
 		};
 
 		class BaseShader : public IResource
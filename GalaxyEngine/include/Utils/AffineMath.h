@@ -0,0 +1,36 @@
+#pragma once
+#include "GalaxyAPI.h"
+#include <galaxymath/Maths.h>
+
+// Transform kernels working on the column major memory of Mat4, using AVX or SSE when the compiler targets them.
+// The matrices are affine : translation in the last column and 0 0 0 1 as last row
+namespace GALAXY::Utils::AffineMath {
+	// Local values of several transforms, one array per component
+	struct TRSBlock
+	{
+		static constexpr size_t capacity = 64;
+
+		alignas(32) float position[3][capacity];
+		alignas(32) float rotation[4][capacity];
+		alignas(32) float scale[3][capacity];
+
+		inline void Set(size_t index, const Vec3f& positionValue, const Quat& rotationValue, const Vec3f& scaleValue);
+	};
+
+	// Write translation * rotation * scale of the first count transforms of the block, the rotations are normalized on the fly
+	void ComposeTRS(const TRSBlock& block, size_t count, Mat4* result);
+
+	// result = parent * local, result can be one of the inputs
+	void Multiply(const Mat4& parent, const Mat4& local, Mat4& result);
+
+	// Inverse transpose of the rotation and scale part, used to transform normals with non uniform scales
+	void ComputeNormalMatrix(const Mat4& model, Mat4& result);
+
+	// Same kernels without any vector instruction, used when the compiler targets none and by the kernel self-test
+	namespace Scalar {
+		void ComposeTRS(const TRSBlock& block, size_t count, Mat4* result);
+		void Multiply(const Mat4& parent, const Mat4& local, Mat4& result);
+		void ComputeNormalMatrix(const Mat4& model, Mat4& result);
+	}
+}
+#include "Utils/AffineMath.inl"
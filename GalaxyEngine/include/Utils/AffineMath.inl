@@ -0,0 +1,18 @@
+#pragma once
+#include "Utils/AffineMath.h"
+namespace GALAXY
+{
+	inline void Utils::AffineMath::TRSBlock::Set(const size_t index, const Vec3f& positionValue, const Quat& rotationValue, const Vec3f& scaleValue)
+	{
+		position[0][index] = positionValue.x;
+		position[1][index] = positionValue.y;
+		position[2][index] = positionValue.z;
+		rotation[0][index] = rotationValue.x;
+		rotation[1][index] = rotationValue.y;
+		rotation[2][index] = rotationValue.z;
+		rotation[3][index] = rotationValue.w;
+		scale[0][index] = scaleValue.x;
+		scale[1][index] = scaleValue.y;
+		scale[2][index] = scaleValue.z;
+	}
+}
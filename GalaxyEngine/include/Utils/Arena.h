@@ -0,0 +1,74 @@
+#pragma once
+#include "GalaxyAPI.h"
+
+namespace GALAXY
+{
+	namespace Utils
+	{
+		// Linear allocator, the memory is released all at once by Reset.
+		// Nothing allocated in it is destroyed, it only holds temporary data. Not thread safe
+		class GALAXY_API Arena
+		{
+		public:
+			explicit Arena(size_t blockSize = 64 * 1024);
+			Arena(const Arena&) = delete;
+			Arena& operator=(const Arena&) = delete;
+			~Arena();
+
+			void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+			// Release everything, the blocks are merged in one so the next use fits in it
+			void Reset();
+
+			inline size_t GetUsed() const;
+			inline size_t GetReserved() const;
+			// Highest usage reached before a reset
+			inline size_t GetPeak() const;
+
+		private:
+			void AddBlock(size_t minSize);
+			void ReleaseBlocks();
+
+		private:
+			struct Block
+			{
+				uint8_t* memory = nullptr;
+				size_t size = 0;
+			};
+			List<Block> m_blocks;
+			size_t m_blockSize = 0;
+			// Offset in the last block
+			size_t m_offset = 0;
+
+			size_t m_used = 0;
+			size_t m_reserved = 0;
+			size_t m_peak = 0;
+		};
+
+		// Standard allocator on top of an arena, deallocate does nothing
+		template<typename T>
+		class ArenaAllocator
+		{
+		public:
+			using value_type = T;
+
+			explicit ArenaAllocator(Arena& arena) noexcept : m_arena(&arena) {}
+			template<typename U>
+			ArenaAllocator(const ArenaAllocator<U>& other) noexcept : m_arena(other.GetArena()) {}
+
+			T* allocate(const size_t count) { return static_cast<T*>(m_arena->Allocate(count * sizeof(T), alignof(T))); }
+			void deallocate(T*, size_t) noexcept {}
+
+			Arena* GetArena() const { return m_arena; }
+
+			template<typename U>
+			bool operator==(const ArenaAllocator<U>& other) const noexcept { return m_arena == other.GetArena(); }
+			template<typename U>
+			bool operator!=(const ArenaAllocator<U>& other) const noexcept { return m_arena != other.GetArena(); }
+
+		private:
+			Arena* m_arena;
+		};
+	}
+}
+#include "Utils/Arena.inl"
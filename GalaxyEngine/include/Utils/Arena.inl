@@ -0,0 +1,19 @@
+#pragma once
+#include "Utils/Arena.h"
+namespace GALAXY
+{
+	inline size_t Utils::Arena::GetUsed() const
+	{
+		return m_used;
+	}
+
+	inline size_t Utils::Arena::GetReserved() const
+	{
+		return m_reserved;
+	}
+
+	inline size_t Utils::Arena::GetPeak() const
+	{
+		return m_peak;
+	}
+}
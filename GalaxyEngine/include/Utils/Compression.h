@@ -0,0 +1,11 @@
+#pragma once
+#include "GalaxyAPI.h"
+#include <vector>
+#include <cstdint>
+
+// Small LZ77 byte compressor, fast enough to be used on editor data every frame
+namespace GALAXY::Utils::Compression {
+	std::vector<uint8_t> Compress(const uint8_t* data, size_t size);
+	// Return false if the data is corrupted, rawSize is the size of the data before compression
+	bool Decompress(const uint8_t* data, size_t size, size_t rawSize, std::vector<uint8_t>& output);
+}
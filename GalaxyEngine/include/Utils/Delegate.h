@@ -0,0 +1,70 @@
+#pragma once
+#include "GalaxyAPI.h"
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <new>
+
+namespace GALAXY
+{
+	namespace Utils
+	{
+		template<typename Signature>
+		class Delegate;
+
+		// Copyable callable like std::function, callables of a few pointers are stored inline without any allocation
+		template<typename R, typename... Args>
+		class Delegate<R(Args...)>
+		{
+		public:
+			static constexpr size_t inlineSize = 4 * sizeof(void*);
+
+			Delegate() = default;
+			template<typename F> requires (!std::is_same_v<std::decay_t<F>, Delegate> && std::is_invocable_r_v<R, std::decay_t<F>&, Args...>)
+			Delegate(F&& func)
+			{
+				using Callable = std::decay_t<F>;
+				// Big callables are stored on the heap, the storage holds their pointer
+				if constexpr (isInline<Callable>)
+					new (m_storage) Callable(std::forward<F>(func));
+				else
+					new (m_storage) Callable*(new Callable(std::forward<F>(func)));
+				m_call = &Call<Callable>;
+				m_manage = &Manage<Callable>;
+			}
+			Delegate(const Delegate& other);
+			Delegate(Delegate&& other) noexcept;
+			Delegate& operator=(const Delegate& other);
+			Delegate& operator=(Delegate&& other) noexcept;
+			~Delegate();
+
+			inline R operator()(Args... args) const;
+
+			inline explicit operator bool() const;
+
+			void Reset();
+
+		private:
+			enum class Operation
+			{
+				Copy,
+				Move,
+				Destroy,
+			};
+
+			template<typename F>
+			static constexpr bool isInline = sizeof(F) <= inlineSize && alignof(F) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<F>;
+
+			template<typename F>
+			static R Call(void* storage, Args... args);
+			template<typename F>
+			static void Manage(Operation operation, void* destination, void* source);
+
+		private:
+			alignas(std::max_align_t) mutable unsigned char m_storage[inlineSize];
+			R (*m_call)(void*, Args...) = nullptr;
+			void (*m_manage)(Operation, void*, void*) = nullptr;
+		};
+	}
+}
+#include "Utils/Delegate.inl"
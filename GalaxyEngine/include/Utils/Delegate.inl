@@ -0,0 +1,127 @@
+#pragma once
+#include "Utils/Delegate.h"
+namespace GALAXY
+{
+	template<typename R, typename... Args>
+	Utils::Delegate<R(Args...)>::Delegate(const Delegate& other) : m_call(other.m_call), m_manage(other.m_manage)
+	{
+		if (m_manage)
+			m_manage(Operation::Copy, m_storage, other.m_storage);
+	}
+
+	template<typename R, typename... Args>
+	Utils::Delegate<R(Args...)>::Delegate(Delegate&& other) noexcept : m_call(other.m_call), m_manage(other.m_manage)
+	{
+		if (m_manage)
+			m_manage(Operation::Move, m_storage, other.m_storage);
+		other.m_call = nullptr;
+		other.m_manage = nullptr;
+	}
+
+	template<typename R, typename... Args>
+	Utils::Delegate<R(Args...)>& Utils::Delegate<R(Args...)>::operator=(const Delegate& other)
+	{
+		if (this != &other)
+		{
+			Reset();
+			m_call = other.m_call;
+			m_manage = other.m_manage;
+			if (m_manage)
+				m_manage(Operation::Copy, m_storage, other.m_storage);
+		}
+		return *this;
+	}
+
+	template<typename R, typename... Args>
+	Utils::Delegate<R(Args...)>& Utils::Delegate<R(Args...)>::operator=(Delegate&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Reset();
+			m_call = other.m_call;
+			m_manage = other.m_manage;
+			if (m_manage)
+				m_manage(Operation::Move, m_storage, other.m_storage);
+			other.m_call = nullptr;
+			other.m_manage = nullptr;
+		}
+		return *this;
+	}
+
+	template<typename R, typename... Args>
+	Utils::Delegate<R(Args...)>::~Delegate()
+	{
+		Reset();
+	}
+
+	template<typename R, typename... Args>
+	inline R Utils::Delegate<R(Args...)>::operator()(Args... args) const
+	{
+		return m_call(m_storage, std::forward<Args>(args)...);
+	}
+
+	template<typename R, typename... Args>
+	inline Utils::Delegate<R(Args...)>::operator bool() const
+	{
+		return m_call != nullptr;
+	}
+
+	template<typename R, typename... Args>
+	void Utils::Delegate<R(Args...)>::Reset()
+	{
+		if (m_manage)
+			m_manage(Operation::Destroy, m_storage, nullptr);
+		m_call = nullptr;
+		m_manage = nullptr;
+	}
+
+	template<typename R, typename... Args>
+	template<typename F>
+	R Utils::Delegate<R(Args...)>::Call(void* storage, Args... args)
+	{
+		if constexpr (isInline<F>)
+			return (*std::launder(static_cast<F*>(storage)))(std::forward<Args>(args)...);
+		else
+			return (**std::launder(static_cast<F**>(storage)))(std::forward<Args>(args)...);
+	}
+
+	template<typename R, typename... Args>
+	template<typename F>
+	void Utils::Delegate<R(Args...)>::Manage(const Operation operation, void* destination, void* source)
+	{
+		if constexpr (isInline<F>)
+		{
+			switch (operation)
+			{
+			case Operation::Copy:
+				new (destination) F(*std::launder(static_cast<const F*>(source)));
+				break;
+			case Operation::Move:
+			{
+				F* sourceCallable = std::launder(static_cast<F*>(source));
+				new (destination) F(std::move(*sourceCallable));
+				sourceCallable->~F();
+				break;
+			}
+			case Operation::Destroy:
+				std::launder(static_cast<F*>(destination))->~F();
+				break;
+			}
+		}
+		else
+		{
+			switch (operation)
+			{
+			case Operation::Copy:
+				new (destination) F*(new F(**std::launder(static_cast<F* const*>(source))));
+				break;
+			case Operation::Move:
+				new (destination) F*(*std::launder(static_cast<F**>(source)));
+				break;
+			case Operation::Destroy:
+				delete *std::launder(static_cast<F**>(destination));
+				break;
+			}
+		}
+	}
+}
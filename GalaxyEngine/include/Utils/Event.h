@@ -1,35 +1,183 @@
 #pragma once
 #include "GalaxyAPI.h"
-#include <functional>
-namespace GALAXY 
+#include "Utils/Delegate.h"
+#include <vector>
+namespace GALAXY
 {
 	namespace Utils
 	{
+		namespace Internal
+		{
+			struct EventStateBase
+			{
+				virtual ~EventStateBase() = default;
+				virtual void Unbind(uint32_t id) = 0;
+			};
+		}
+
+		// Binding of a callback to an event, the callback is unbound when the subscription is destroyed or reset.
+		// The subscription can outlive its event
+		class EventSubscription
+		{
+		public:
+			EventSubscription() = default;
+			EventSubscription(const Weak<Internal::EventStateBase>& state, const uint32_t id) : m_state(state), m_id(id) {}
+			EventSubscription& operator=(const EventSubscription& other) = delete;
+			EventSubscription(const EventSubscription&) = delete;
+			EventSubscription(EventSubscription&& other) noexcept : m_state(std::move(other.m_state)), m_id(other.m_id) { other.m_id = 0; }
+			EventSubscription& operator=(EventSubscription&& other) noexcept
+			{
+				if (this != &other)
+				{
+					Reset();
+					m_state = std::move(other.m_state);
+					m_id = other.m_id;
+					other.m_id = 0;
+				}
+				return *this;
+			}
+			~EventSubscription() { Reset(); }
+
+			void Reset()
+			{
+				if (const Shared<Internal::EventStateBase> state = m_state.lock())
+					state->Unbind(m_id);
+				m_state.reset();
+				m_id = 0;
+			}
+
+			bool IsBound() const { return m_id != 0 && !m_state.expired(); }
+
+		private:
+			Weak<Internal::EventStateBase> m_state;
+			uint32_t m_id = 0;
+		};
+
+		// The bindings belong to one event, a copy starts without any and an assigned event loses its own
 		template<typename... Args>
 		class Event {
 		public:
 			Event() = default;
-			Event& operator=(const Event& other) = default;
-			Event(const Event&) = default;
+			Event& operator=(const Event& other)
+			{
+				if (this != &other)
+					m_state.reset();
+				return *this;
+			}
+			Event(const Event&) {}
 			Event(Event&&) noexcept = default;
-			virtual ~Event() = default;
+			Event& operator=(Event&&) noexcept = default;
+			~Event() = default;
 
-			using Callback = std::function<void(Args...)>;
+			using Callback = Delegate<void(Args...)>;
 
-			inline virtual void Bind(Callback callback)
+			// Bind the callback for the lifetime of the event
+			inline void Bind(Callback callback)
 			{
-				m_callbacks.push_back(callback);
+				GetState().Add(std::move(callback));
 			}
 
+			// Bind the callback until the returned subscription is destroyed
+			[[nodiscard]] inline EventSubscription Subscribe(Callback callback)
+			{
+				State& state = GetState();
+				const uint32_t id = state.Add(std::move(callback));
+				return EventSubscription(m_state, id);
+			}
+
+			// Callbacks can bind or unbind during the call, the new ones are called from the next invocation
 			inline void Invoke(Args... args)
 			{
-				for (auto& callback : m_callbacks)
+				if (!m_state || m_state->bindings.empty())
+					return;
+				// A callback can destroy the event
+				const Shared<State> state = m_state;
+				state->invoking++;
+				const size_t size = state->bindings.size();
+				for (size_t i = 0; i < size; i++)
 				{
-					callback(args...);
+					if (state->bindings[i].id != 0)
+						state->bindings[i].callback(args...);
 				}
+				state->invoking--;
+				if (state->invoking == 0)
+					state->Compact();
 			}
+
+			inline bool IsEmpty() const
+			{
+				return !m_state || m_state->bindings.empty();
+			}
+
+		private:
+			struct Binding
+			{
+				// 0 once unbound during an invocation
+				uint32_t id;
+				Callback callback;
+			};
+
+			struct State : Internal::EventStateBase
+			{
+				List<Binding> bindings;
+				// Bound during an invocation, moving the bindings would move the callback being called
+				List<Binding> pending;
+				uint32_t nextId = 1;
+				uint32_t invoking = 0;
+				bool hasHoles = false;
+
+				uint32_t Add(Callback&& callback)
+				{
+					const uint32_t id = nextId++;
+					(invoking > 0 ? pending : bindings).push_back({ id, std::move(callback) });
+					return id;
+				}
+
+				void Unbind(const uint32_t id) override
+				{
+					for (List<Binding>* list : { &bindings, &pending })
+					{
+						for (size_t i = 0; i < list->size(); i++)
+						{
+							if ((*list)[i].id != id)
+								continue;
+							// The callback can be the one being called
+							if (invoking > 0)
+							{
+								(*list)[i].id = 0;
+								hasHoles = true;
+							}
+							else
+								list->erase(list->begin() + i);
+							return;
+						}
+					}
+				}
+
+				void Compact()
+				{
+					if (hasHoles)
+						std::erase_if(bindings, [](const Binding& binding) { return binding.id == 0; });
+					hasHoles = false;
+					for (Binding& binding : pending)
+					{
+						if (binding.id != 0)
+							bindings.push_back(std::move(binding));
+					}
+					pending.clear();
+				}
+			};
+
+			State& GetState()
+			{
+				// Created on the first binding, most events are never bound
+				if (!m_state)
+					m_state = std::make_shared<State>();
+				return *m_state;
+			}
+
 		private:
-			std::vector<Callback> m_callbacks;
+			Shared<State> m_state;
 		};
 	}
 }
@@ -5,6 +5,8 @@ namespace GALAXY::Utils::FileSystem {
 	std::fstream OpenFile(const std::filesystem::path& path);
 	std::string ReadFile(const std::filesystem::path& path);
 	std::ofstream GenerateFile(const std::filesystem::path& path);
+	// Write and flush the content to a temporary file then rename it to the path, the previous file stays intact on failure
+	bool WriteFileAtomic(const std::filesystem::path& path, const std::string& content);
 
 	bool RemoveFile(const std::filesystem::path& path);
 
@@ -0,0 +1,79 @@
+#pragma once
+#include "GalaxyAPI.h"
+#include <atomic>
+#include <mutex>
+#include <iterator>
+
+namespace GALAXY
+{
+	namespace Utils
+	{
+		// Allocator for small objects, sizes are rounded up to a size class with its own free list.
+		// Each thread keeps a few free blocks per class so most allocations don't take the lock
+		class GALAXY_API MemoryPool
+		{
+		public:
+			static constexpr size_t alignment = 16;
+			static constexpr size_t classSizes[] = { 16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048 };
+			static constexpr size_t classCount = std::size(classSizes);
+
+			struct Stats
+			{
+				size_t size = 0;
+				// Blocks given to the callers
+				size_t used = 0;
+				// Bytes taken from the system
+				size_t reserved = 0;
+			};
+
+			// Bigger sizes fall back to operator new
+			static void* Allocate(size_t size);
+			static void Free(void* pointer, size_t size);
+
+			static List<Stats> GetStats();
+			// Allocations too big for the size classes
+			static size_t GetLargeCount();
+
+		private:
+			struct SizeClass
+			{
+				std::mutex mutex;
+				void* freeList = nullptr;
+				List<void*> slabs;
+				std::atomic_size_t used = 0;
+				std::atomic_size_t reserved = 0;
+			};
+			struct ThreadCache;
+
+			static inline size_t GetClassIndex(size_t size);
+			static SizeClass* GetClasses();
+			static ThreadCache& GetThreadCache();
+
+			// Move blocks from the class to the cache of the thread
+			static void Refill(ThreadCache& cache, size_t classIndex);
+			// Give back blocks cached by the thread to their class
+			static void Drain(ThreadCache& cache, size_t classIndex, uint32_t count);
+		};
+
+		// Standard allocator on top of the memory pool, to use with std::allocate_shared and the containers
+		template<typename T>
+		class PoolAllocator
+		{
+		public:
+			using value_type = T;
+
+			PoolAllocator() noexcept = default;
+			template<typename U>
+			PoolAllocator(const PoolAllocator<U>&) noexcept {}
+
+			inline T* allocate(size_t count);
+			inline void deallocate(T* pointer, size_t count) noexcept;
+
+			template<typename U>
+			bool operator==(const PoolAllocator<U>&) const noexcept { return true; }
+			template<typename U>
+			bool operator!=(const PoolAllocator<U>&) const noexcept { return false; }
+		};
+	}
+}
+#include "Utils/MemoryPool.inl"
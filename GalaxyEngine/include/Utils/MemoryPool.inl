@@ -0,0 +1,32 @@
+#pragma once
+#include "Utils/MemoryPool.h"
+namespace GALAXY
+{
+	inline size_t Utils::MemoryPool::GetClassIndex(const size_t size)
+	{
+		for (size_t i = 0; i < classCount; i++)
+		{
+			if (size <= classSizes[i])
+				return i;
+		}
+		return classCount;
+	}
+
+	template<typename T>
+	inline T* Utils::PoolAllocator<T>::allocate(const size_t count)
+	{
+		if constexpr (alignof(T) > MemoryPool::alignment)
+			return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(alignof(T))));
+		else
+			return static_cast<T*>(MemoryPool::Allocate(count * sizeof(T)));
+	}
+
+	template<typename T>
+	inline void Utils::PoolAllocator<T>::deallocate(T* pointer, const size_t count) noexcept
+	{
+		if constexpr (alignof(T) > MemoryPool::alignment)
+			::operator delete(pointer, std::align_val_t(alignof(T)));
+		else
+			MemoryPool::Free(pointer, count * sizeof(T));
+	}
+}
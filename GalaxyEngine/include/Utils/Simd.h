@@ -0,0 +1,26 @@
+#pragma once
+
+// Vector instruction sets targeted by the compiler, shared by the kernels of the engine.
+// AVX is only enabled by the avx2 option of the build, SSE2 is always there on x64
+#if defined(__AVX__)
+#include <immintrin.h>
+#define GALAXY_SIMD_AVX
+#define GALAXY_SIMD_SSE
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GALAXY_SIMD_SSE
+#endif
+
+namespace GALAXY::Utils::Simd {
+	// Name of the instruction set used by the kernels
+	inline const char* GetInstructionSet()
+	{
+#if defined(GALAXY_SIMD_AVX)
+		return "AVX";
+#elif defined(GALAXY_SIMD_SSE)
+		return "SSE";
+#else
+		return "Scalar";
+#endif
+	}
+}
@@ -83,7 +83,6 @@ namespace GALAXY
 			void ActiveDepth(bool active = true) override;
 			void SetDepthRange(float _near, float _far) override;
 
-			Vec4f ReadPixelColor(const Vec2f& mousePos) override;
 			void ReadPixels(const Vec2i& size, unsigned char*& data) override;
 
 			// Debug
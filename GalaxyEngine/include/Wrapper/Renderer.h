@@ -25,7 +25,6 @@ namespace GALAXY
 		enum class RenderType
 		{
 			Default,
-			Picking,
 			Outline
 		};
 	}
@@ -129,7 +128,6 @@ namespace GALAXY
 			virtual void ActiveDepth(bool active = true) {}
 			virtual void SetDepthRange(float _near, float _far) {}
 
-			virtual Vec4f ReadPixelColor(const Vec2f& mousePos) { return Vec4f(0, 0, 0, 0); }
 			virtual void ReadPixels(const Vec2i& size, unsigned char*& data) { }
 
 			// Debug
@@ -45,7 +45,7 @@ namespace GALAXY
 
 #ifdef WITH_EDITOR
 		m_editorIcon.SetPosition(GetTransform()->GetModelMatrix().GetTranslation());
-		m_editorIcon.Render(game_object->GetSceneGraphID());
+		m_editorIcon.Render();
 #endif
 
 		if (game_object->IsSelected())
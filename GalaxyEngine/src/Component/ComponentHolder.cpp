@@ -10,6 +10,7 @@
 #include "Component/Emitter.h"
 
 std::vector<std::shared_ptr<Component::BaseComponent>> Component::ComponentHolder::m_componentList;
+UMap<std::string, size_t> Component::ComponentHolder::m_nameIndices;
 
 using namespace Component;
 void ComponentHolder::Initialize()
@@ -23,21 +24,38 @@ void ComponentHolder::Initialize()
 	RegisterComponent<Listener>();
 }
 
+void ComponentHolder::AddComponent(const Shared<BaseComponent>& component)
+{
+	m_nameIndices[component->GetComponentName()] = m_componentList.size();
+	m_componentList.push_back(component);
+}
+
 void ComponentHolder::UnregisterComponentByName(const std::string& componentName)
 {
-	for (auto it = m_componentList.begin(); it != m_componentList.end(); it++)
+	const auto index = m_nameIndices.find(componentName);
+	if (index == m_nameIndices.end())
+		return;
+	// The list keeps its order, it is the one of the component menu
+	const size_t removedIndex = index->second;
+	m_nameIndices.erase(index);
+	m_componentList.erase(m_componentList.begin() + removedIndex);
+	for (size_t i = removedIndex; i < m_componentList.size(); i++)
 	{
-		std::string componentName2 = (*it)->GetComponentName();
-		if (componentName2 == componentName)
-		{
-			m_componentList.erase(it);
-			return;
-		}
+		m_nameIndices[m_componentList[i]->GetComponentName()] = i;
 	}
 }
 
+Shared<BaseComponent> ComponentHolder::GetWithName(const std::string& componentName)
+{
+	const auto index = m_nameIndices.find(componentName);
+	if (index == m_nameIndices.end())
+		return nullptr;
+	return m_componentList[index->second];
+}
+
 void ComponentHolder::Release()
 {
 	m_componentList.clear();
+	m_nameIndices.clear();
 }
 
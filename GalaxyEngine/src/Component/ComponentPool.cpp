@@ -0,0 +1,129 @@
+#include "pch.h"
+#include "Component/ComponentPool.h"
+
+#include <bit>
+
+namespace GALAXY
+{
+	Component::ComponentPoolBase::ComponentPoolBase(const size_t slotSize, const size_t slotAlignment, const ToBaseFunction toBase)
+		: m_slotSize((slotSize + slotAlignment - 1) / slotAlignment * slotAlignment), m_slotAlignment(slotAlignment), m_toBase(toBase)
+	{
+	}
+
+	Component::ComponentPoolBase::~ComponentPoolBase()
+	{
+		for (const Chunk& chunk : m_chunks)
+		{
+			::operator delete(chunk.memory, std::align_val_t(m_slotAlignment));
+		}
+	}
+
+	uint32_t Component::ComponentPoolBase::Allocate()
+	{
+		std::lock_guard lock(m_mutex);
+		if (m_freeSlots.empty())
+		{
+			Chunk& chunk = m_chunks.emplace_back();
+			chunk.memory = static_cast<std::byte*>(::operator new(m_slotSize * chunkSize, std::align_val_t(m_slotAlignment)));
+			// Lowest indices at the back so the slots are used in memory order
+			const uint32_t firstIndex = static_cast<uint32_t>(m_chunks.size() - 1) * chunkSize;
+			for (uint32_t i = chunkSize; i > 0; i--)
+			{
+				m_freeSlots.push_back(firstIndex + i - 1);
+			}
+		}
+		const uint32_t index = m_freeSlots.back();
+		m_freeSlots.pop_back();
+		return index;
+	}
+
+	void Component::ComponentPoolBase::SetAlive(const uint32_t index)
+	{
+		std::lock_guard lock(m_mutex);
+		m_chunks[index / chunkSize].alive[index % chunkSize / 64] |= uint64_t(1) << (index % 64);
+		m_count++;
+	}
+
+	void Component::ComponentPoolBase::Free(const uint32_t index)
+	{
+		bool release;
+		{
+			std::lock_guard lock(m_mutex);
+			m_chunks[index / chunkSize].alive[index % chunkSize / 64] &= ~(uint64_t(1) << (index % 64));
+			m_freeSlots.push_back(index);
+			m_count--;
+			release = m_retired && m_count == 0;
+		}
+		// The last component of a replaced pool is gone, nothing can reach the pool anymore
+		if (release)
+			delete this;
+	}
+
+	Component::BaseComponent* Component::ComponentPoolBase::GetAny()
+	{
+		std::lock_guard lock(m_mutex);
+		for (const Chunk& chunk : m_chunks)
+		{
+			for (uint32_t word = 0; word < chunkSize / 64; word++)
+			{
+				if (chunk.alive[word] != 0)
+					return m_toBase(chunk.memory + (word * 64 + std::countr_zero(chunk.alive[word])) * m_slotSize);
+			}
+		}
+		return nullptr;
+	}
+
+	// Only a replaced pool is destroyed, components can still be released during the static destruction
+	static std::mutex poolsMutex;
+	static std::atomic_uint32_t poolsVersion = 0;
+	static UMap<std::type_index, Component::ComponentPoolBase*>& GetPoolMap()
+	{
+		static UMap<std::type_index, Component::ComponentPoolBase*>* pools = new UMap<std::type_index, Component::ComponentPoolBase*>();
+		return *pools;
+	}
+
+	Component::ComponentPoolBase* Component::ComponentPoolBase::Get(const std::type_index& type, const size_t slotSize, const size_t slotAlignment, const ToBaseFunction toBase)
+	{
+		std::lock_guard lock(poolsMutex);
+		ComponentPoolBase*& pool = GetPoolMap()[type];
+		if (pool && pool->m_slotSize >= slotSize && pool->m_slotAlignment == slotAlignment)
+		{
+			pool->m_toBase = toBase;
+			return pool;
+		}
+
+		// A reloaded script class keeps its name but can change of size, it gets a new pool.
+		// The old one is released now if empty, else by its last component
+		if (pool)
+		{
+			bool release;
+			{
+				std::lock_guard poolLock(pool->m_mutex);
+				release = pool->m_count == 0;
+				pool->m_retired = true;
+			}
+			if (release)
+				delete pool;
+		}
+		pool = new ComponentPoolBase(slotSize, slotAlignment, toBase);
+		++poolsVersion;
+		return pool;
+	}
+
+	List<Component::ComponentPoolBase*> Component::ComponentPoolBase::GetPools()
+	{
+		std::lock_guard lock(poolsMutex);
+		List<ComponentPoolBase*> pools;
+		pools.reserve(GetPoolMap().size());
+		for (const auto& pool : GetPoolMap())
+		{
+			pools.push_back(pool.second);
+		}
+		return pools;
+	}
+
+	uint32_t Component::ComponentPoolBase::GetPoolsVersion()
+	{
+		return poolsVersion.load();
+	}
+}
@@ -0,0 +1,42 @@
+#include "pch.h"
+#include "Component/ComponentType.h"
+
+namespace GALAXY
+{
+	std::mutex Component::ComponentTypes::s_mutex;
+	List<Component::ComponentTypes::Type> Component::ComponentTypes::s_types;
+
+	Component::ComponentTypeID Component::ComponentTypes::Register(const std::type_index type, const char* name)
+	{
+		std::lock_guard lock(s_mutex);
+		for (ComponentTypeID id = 0; id < s_types.size(); id++)
+		{
+			if (s_types[id].type != type)
+				continue;
+			if (!s_types[id].name)
+				s_types[id].name = name;
+			return id;
+		}
+		if (s_types.size() == 64)
+			PrintWarning("More than 64 component types, the next ones are queried without their bit");
+		s_types.push_back({ type, name });
+		return static_cast<ComponentTypeID>(s_types.size() - 1);
+	}
+
+	Component::ComponentMask Component::ComponentTypes::GetBitWithName(const String& name)
+	{
+		std::lock_guard lock(s_mutex);
+		for (ComponentTypeID id = 0; id < s_types.size() && id < 64; id++)
+		{
+			if (s_types[id].name && name == s_types[id].name)
+				return ComponentMask(1) << id;
+		}
+		return 0;
+	}
+
+	size_t Component::ComponentTypes::GetCount()
+	{
+		std::lock_guard lock(s_mutex);
+		return s_types.size();
+	}
+}
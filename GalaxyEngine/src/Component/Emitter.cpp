@@ -106,7 +106,6 @@ namespace GALAXY
     {
         auto audioInstance = Wrapper::Audio::GetInstance();
         audioInstance->AddEmitter(this);
-        GetGameObject()->GetTransform()->EOnUpdate.Bind(std::bind(&Emitter::OnTransformUpdate, this));
     }
     
     void Component::Emitter::OnDestroy()
@@ -149,6 +148,8 @@ namespace GALAXY
             audioInstance->UpdateEmitterSound(this);
             m_duration = audioInstance->GetSoundDuration(GetGameObject()->GetUUID());
         }
+        if (!same)
+            SetModified();
     }
 
     void Component::Emitter::SetVolume(float volume)
@@ -156,6 +157,7 @@ namespace GALAXY
         m_volume = volume;
         auto audioInstance = Wrapper::Audio::GetInstance();
         audioInstance->SetEmitterVolume(p_gameObject->GetUUID(), volume);
+        SetModified();
     }
 
     void Component::Emitter::SetPitch(float pitch)
@@ -163,6 +165,7 @@ namespace GALAXY
         m_pitch = pitch;
         auto audioInstance = Wrapper::Audio::GetInstance();
         audioInstance->SetPitch(p_gameObject->GetUUID(), pitch);
+        SetModified();
     }
 
     void Component::Emitter::SetMinDistance(float minDistance)
@@ -170,6 +173,7 @@ namespace GALAXY
         m_minDistance = minDistance;
         auto audioInstance = Wrapper::Audio::GetInstance();
         audioInstance->SetMinDistance(p_gameObject->GetUUID(), minDistance);
+        SetModified();
     }
 
     void Component::Emitter::SetMaxDistance(float maxDistance)
@@ -177,6 +181,7 @@ namespace GALAXY
         m_maxDistance = maxDistance;
         auto audioInstance = Wrapper::Audio::GetInstance();
         audioInstance->SetMaxDistance(p_gameObject->GetUUID(), maxDistance);
+        SetModified();
     }
 
     void Component::Emitter::SetAttenuationModel(AttenuationModel attenuationModel)
@@ -184,6 +189,7 @@ namespace GALAXY
         m_attenuationModel = attenuationModel;
         auto audioInstance = Wrapper::Audio::GetInstance();
         audioInstance->SetAttenuationModel(p_gameObject->GetUUID(), attenuationModel);
+        SetModified();
     }
 
     void Component::Emitter::SetLooping(bool isLooping)
@@ -191,6 +197,7 @@ namespace GALAXY
         m_isLooping = isLooping;
         auto audioInstance = Wrapper::Audio::GetInstance();
         audioInstance->SetLooping(p_gameObject->GetUUID(), isLooping);
+        SetModified();
     }
 
     void Component::Emitter::SetDopplerFactor(float dopplerFactor)
@@ -198,6 +205,7 @@ namespace GALAXY
         m_dopplerFactor = dopplerFactor;
         auto audioInstance = Wrapper::Audio::GetInstance();
         audioInstance->SetDopplerFactor(p_gameObject->GetUUID(), dopplerFactor);
+        SetModified();
     }
 
     void Component::Emitter::SetPan(float pan)
@@ -205,6 +213,7 @@ namespace GALAXY
         m_pan = pan;
         auto audioInstance = Wrapper::Audio::GetInstance();
         audioInstance->SetPan(p_gameObject->GetUUID(), pan);
+        SetModified();
     }
 
     void Component::Emitter::Serialize(CppSer::Serializer& serializer)
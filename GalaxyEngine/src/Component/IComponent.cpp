@@ -1,6 +1,9 @@
 #include "pch.h"
 #include "Component/IComponent.h"
 #include "Core/GameObject.h"
+#include "Core/TickRegistry.h"
+
+#include "Resource/Scene.h"
 
 namespace GALAXY {
 	void Component::BaseComponent::RemoveFromGameObject()
@@ -21,9 +24,77 @@ namespace GALAXY {
 		return p_gameObject->GetTransform();
 	}
 
+	void Component::BaseComponent::SetSelfEnable(const bool enable)
+	{
+		if (p_enable == enable)
+			return;
+		p_enable = enable;
+		SetModified();
+	}
+
+	void Component::BaseComponent::SetModified() const
+	{
+		if (p_gameObject)
+			p_gameObject->SetModified();
+	}
+
+	void Component::BaseComponent::SetTickEnabled(const TickFlag flags, const bool enable)
+	{
+		p_tick.disabled = enable ? p_tick.disabled & ~flags : p_tick.disabled | flags;
+		UpdateTickRegistration();
+	}
+
+	void Component::BaseComponent::UpdateTickRegistration()
+	{
+		const Resource::Scene* scene = p_gameObject ? p_gameObject->GetScene() : nullptr;
+		Core::TickRegistry* registry = scene ? scene->GetTickRegistry() : nullptr;
+		if (p_tick.registry != registry)
+		{
+			ClearTickRegistration();
+			p_tick.registry = registry;
+		}
+		if (!registry)
+			return;
+
+		const TickFlag flags = GetTickFlags() & ~p_tick.disabled;
+		for (uint32_t group = 0; group < tickGroupCount; group++)
+		{
+			const bool wanted = (flags & static_cast<TickFlag>(1 << group)) != TickFlag::None;
+			const bool registered = p_tick.indices[group] != INDEX_NONE;
+			if (wanted && !registered)
+				registry->Register(this, group);
+			else if (!wanted && registered)
+				registry->Unregister(this, group);
+		}
+	}
+
+	void Component::BaseComponent::ClearTickRegistration()
+	{
+		if (!p_tick.registry)
+			return;
+		for (uint32_t group = 0; group < tickGroupCount; group++)
+		{
+			if (p_tick.indices[group] != INDEX_NONE)
+				p_tick.registry->Unregister(this, group);
+		}
+		p_tick.registry = nullptr;
+	}
+
 	Component::BaseComponent::BaseComponent()
 	{
 
 	}
 
+	Component::BaseComponent::~BaseComponent()
+	{
+		p_handle.Release(GetHandleTable());
+		ClearTickRegistration();
+	}
+
+	Core::HandleTable& Component::BaseComponent::GetHandleTable()
+	{
+		static Core::HandleTable table;
+		return table;
+	}
+
 }
\ No newline at end of file
@@ -16,7 +16,7 @@ namespace GALAXY
 
 	void Component::Light::OnCreate()
 	{
-		if (!Render::LightManager::AddLight(GetGameObject()->GetWeakOfComponent(this)))
+		if (!Render::LightManager::AddLight(this))
 		{
 			RemoveFromGameObject();
 		}
@@ -27,15 +27,14 @@ namespace GALAXY
 
 	void Component::Light::OnDestroy()
 	{
-		const Weak<Light> weak_this = GetGameObject()->GetWeakOfComponent(this);
-		Render::LightManager::RemoveLight(weak_this);
+		Render::LightManager::RemoveLight(this);
 	}
 
 	void Component::Light::OnEditorDraw()
 	{
 #ifdef WITH_EDITOR
 		m_editorIcon.SetPosition(GetTransform()->GetModelMatrix().GetTranslation());
-		m_editorIcon.Render(GetGameObject()->GetSceneGraphID());
+		m_editorIcon.Render();
 #endif
 	}
 
@@ -20,7 +20,6 @@ namespace GALAXY
     {
         auto audioInstance = Wrapper::Audio::GetInstance();
         audioInstance->AddListener(this);
-        p_gameObject->GetTransform()->EOnUpdate.Bind(std::bind(&Listener::OnTransformUpdate, this));
     }
 
     void Component::Listener::OnDestroy()
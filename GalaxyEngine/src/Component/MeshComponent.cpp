@@ -13,6 +13,7 @@
 #include "Wrapper/Renderer.h"
 
 #include "Core/GameObject.h"
+#include "Core/BoundsRegistry.h"
 
 #if WITH_EDITOR
 #include "Editor/EditorCamera.h"
@@ -23,17 +24,40 @@ namespace GALAXY {
 	void Component::MeshComponent::OnDraw()
 	{
 		auto gameObject = GetGameObject();
-		auto mesh = m_mesh.lock();
+		// Locked once, every lock is an atomic increment and decrement
+		const Shared<Resource::Mesh> mesh = m_mesh.lock();
 		if (!mesh)
 			return;
 
+		Transform* transform = gameObject->GetTransform();
 		if (m_drawBoundingBox)
-			m_mesh.lock()->DrawBoundingBox(gameObject->GetTransform());
+			mesh->DrawBoundingBox(transform);
 
 		const auto& currentCamera = gameObject->GetScene()->GetCurrentCamera();
-		if (currentCamera && !mesh->GetBoundingBox().IsOnFrustum(currentCamera.get(), GetTransform()))
+		if (currentCamera && !IsInFrustum(mesh.get(), currentCamera->GetFrustum()))
 			return;
-		m_mesh.lock()->Render(gameObject->GetTransform()->GetModelMatrix(), m_materials, gameObject->GetScene(), gameObject->GetSceneGraphID());
+		mesh->Render(transform->GetModelMatrix(), m_materials, gameObject->GetScene());
+	}
+
+	Physic::AABB Component::MeshComponent::GetWorldBounds(const Resource::Mesh* mesh) const
+	{
+		const Core::BoundsRegistry* registry = GetGameObject()->GetScene()->GetBoundsRegistry();
+		const uint32_t index = registry->GetIndex(this, mesh);
+		if (index != INDEX_NONE)
+			return registry->GetBounds().Get(index);
+		// Registered or moved after the last update of the registry
+		const Resource::BoundingBox localBounds = mesh->GetBoundingBox();
+		return Physic::AABB(localBounds.min, localBounds.max).Transform(GetTransform()->GetModelMatrix());
+	}
+
+	bool Component::MeshComponent::IsInFrustum(const Resource::Mesh* mesh, const Physic::Frustum& frustum) const
+	{
+		// Culled in batch by the scene when the camera was set
+		const Core::BoundsRegistry* registry = GetGameObject()->GetScene()->GetBoundsRegistry();
+		const uint32_t index = registry->GetIndex(this, mesh);
+		if (index != INDEX_NONE && registry->WasCulled(index))
+			return registry->IsVisible(index);
+		return GetWorldBounds(mesh).IntersectsFrustum(frustum);
 	}
 
 	void Component::MeshComponent::Serialize(CppSer::Serializer& serializer)
@@ -44,6 +68,7 @@ namespace GALAXY {
 			serializer << CppSer::Pair::Key << "Model" << CppSer::Pair::Value << UUID_NULL;
 
 		serializer << CppSer::Pair::Key << "Mesh Name" << CppSer::Pair::Value << (m_mesh.lock() ? m_mesh.lock()->GetMeshName() : NONE_RESOURCE);
+		serializer << CppSer::Pair::Key << "Occluder" << CppSer::Pair::Value << m_occluder;
 		serializer << CppSer::Pair::Key << "Material Count" << CppSer::Pair::Value << m_materials.size();
 
 		serializer << CppSer::Pair::BeginTab;
@@ -70,6 +95,8 @@ namespace GALAXY {
 			PrintError("Model with uuid %llu not found", modelUUID);
 		}
 
+		m_occluder = parser["Occluder"].As<bool>();
+
 		const size_t materialCount = parser["Material Count"].As<int>();
 		for (size_t i = 0; i < materialCount; i++)
 		{
@@ -82,6 +109,7 @@ namespace GALAXY {
 	void Component::MeshComponent::AddMaterial(const Weak<Resource::Material>& material)
 	{
 		m_materials.push_back(material);
+		SetModified();
 	}
 
 	void Component::MeshComponent::RemoveMaterial(size_t index)
@@ -89,6 +117,7 @@ namespace GALAXY {
 		if (m_materials.size() > index)
 		{
 			m_materials.erase(m_materials.begin() + index);
+			SetModified();
 		}
 		else
 		{
@@ -99,12 +128,14 @@ namespace GALAXY {
 	void Component::MeshComponent::ClearMaterials()
 	{
 		m_materials.clear();
+		SetModified();
 	}
 
 	void Component::MeshComponent::ShowInInspector()
 	{
 		Vec2f buttonSize = { ImGui::GetContentRegionAvail().x, 0 };
 		ImGui::Checkbox("Draw bounding box", &m_drawBoundingBox);
+		ImGui::Checkbox("Occluder", &m_occluder);
 		if (ImGui::Button(m_mesh.lock() ? m_mesh.lock()->GetFileInfo().GetFileName().c_str() : "Empty", buttonSize))
 		{
 			ImGui::OpenPopup("MeshPopup");
@@ -113,6 +144,7 @@ namespace GALAXY {
 		if (Resource::ResourceManager::GetInstance()->ResourcePopup("MeshPopup", mesh))
 		{
 			m_mesh = mesh;
+			SetModified();
 		}
 		static uint32_t selected = 0;
 		static uint32_t clicked = 0;
@@ -147,6 +179,7 @@ namespace GALAXY {
 						auto mat = m_materials[index];
 						m_materials.erase(m_materials.begin() + index);
 						m_materials.insert(m_materials.begin() + i, mat);
+						SetModified();
 					}
 					ImGui::EndDragDropTarget();
 				}
@@ -156,12 +189,13 @@ namespace GALAXY {
 			if (Resource::ResourceManager::GetInstance()->ResourcePopup("MaterialPopup", mat))
 			{
 				m_materials[clicked] = mat;
+				SetModified();
 			}
 			ImGui::PopID();
 			ImGui::PushStyleColor(ImGuiCol_Button, Vec4f(0.15f, 0.8f, 0.1f, 1.f));
 			if (ImGui::Button("Add"))
 			{
-				m_materials.push_back(std::weak_ptr<Resource::Material>());
+				AddMaterial(std::weak_ptr<Resource::Material>());
 			}
 			ImGui::PopStyleColor();
 			ImGui::SameLine();
@@ -169,7 +203,7 @@ namespace GALAXY {
 			if (ImGui::Button("Remove"))
 			{
 				if (selected >= 0 && selected < m_materials.size())
-					m_materials.erase(m_materials.begin() + selected);
+					RemoveMaterial(selected);
 			}
 			ImGui::PopStyleColor();
 			ImGui::TreePop();
@@ -23,6 +23,31 @@ namespace GALAXY
 
 	}
 
+	Component::Transform::Transform(const Transform& other) : IComponent(other)
+	{
+		*this = other;
+	}
+
+	Component::Transform& Component::Transform::operator=(const Transform& other)
+	{
+		IComponent::operator=(other);
+		m_modelMatrix = other.GetModelMatrix();
+		m_localPosition = other.m_localPosition;
+		m_localRotation = other.m_localRotation;
+		m_localEulerRotation = other.m_localEulerRotation;
+		m_localScale = other.m_localScale;
+		m_wasDirty = other.m_wasDirty;
+		m_modelVersion++;
+		SetDirty();
+		return *this;
+	}
+
+	Component::Transform::~Transform()
+	{
+		if (m_hierarchy)
+			m_hierarchy->Remove(m_hierarchyIndex);
+	}
+
 	Vec3f Component::Transform::GetWorldPosition() const
 	{
 		if (p_gameObject && p_gameObject->GetParent())
@@ -39,7 +64,7 @@ namespace GALAXY
 	{
 		if (p_gameObject && p_gameObject->GetParent())
 		{
-			return GetModelMatrix().GetRotation();
+			return GetWorldCache().rotation;
 		}
 		else
 		{
@@ -47,8 +72,26 @@ namespace GALAXY
 		}
 	}
 
+	const Component::Transform::WorldCache& Component::Transform::GetWorldCache() const
+	{
+		const uint32_t version = GetModelVersion();
+		if (m_worldCache.version != version)
+		{
+			const Mat4& modelMatrix = GetModelMatrix();
+			m_worldCache.rotation = modelMatrix.GetRotation();
+			m_worldCache.eulerRotation = m_worldCache.rotation.ToEuler();
+			m_worldCache.scale = modelMatrix.GetScale();
+			m_worldCache.version = version;
+		}
+		return m_worldCache;
+	}
+
 	void Component::Transform::OnUpdate()
 	{
+		// The transforms of a scene are updated by its hierarchy, which also invokes their update event
+		if (m_hierarchy)
+			return;
+
 		m_wasDirty = false;
 		if (!m_dirty)
 			return;
@@ -56,8 +99,21 @@ namespace GALAXY
 		ForceUpdate();
 	}
 
+	bool Component::Transform::WasDirty() const
+	{
+		if (m_hierarchy)
+			return m_hierarchy->WasUpdated(m_hierarchyIndex);
+		return m_wasDirty;
+	}
+
 	void Component::Transform::ForceUpdate()
 	{
+		if (m_hierarchy)
+		{
+			SetDirty();
+			return;
+		}
+
 		EOnUpdate.Invoke();
 		if (p_gameObject && p_gameObject->GetParent())
 			ComputeModelMatrix(p_gameObject->GetParent()->GetTransform()->GetModelMatrix());
@@ -67,10 +123,10 @@ namespace GALAXY
 
 		if (p_gameObject)
 		{
-			for (auto& child : p_gameObject->GetChildren())
-			{
-				child.lock()->GetTransform()->ForceUpdate();
-			}
+			p_gameObject->ForEachChild([](Core::GameObject* child)
+				{
+					child->GetTransform()->ForceUpdate();
+				});
 		}
 	}
 
@@ -78,7 +134,7 @@ namespace GALAXY
 	{
 		if (p_gameObject && p_gameObject->GetParent())
 		{
-			return GetModelMatrix().GetScale();
+			return GetWorldCache().scale;
 		}
 		else
 		{
@@ -90,7 +146,7 @@ namespace GALAXY
 	{
 		if (p_gameObject && p_gameObject->GetParent())
 		{
-			return GetModelMatrix().GetRotation().ToEuler();
+			return GetWorldCache().eulerRotation;
 		}
 		else
 		{
@@ -201,9 +257,14 @@ namespace GALAXY
 
 	void Component::Transform::Serialize(CppSer::Serializer& serializer)
 	{
-		serializer << CppSer::Pair::Key << "Position" << CppSer::Pair::Value << m_localPosition;
-		serializer << CppSer::Pair::Key << "Rotation" << CppSer::Pair::Value << m_localRotation;
-		serializer << CppSer::Pair::Key << "Scale" << CppSer::Pair::Value << m_localScale;
+		SerializeLocal(serializer, m_localPosition, m_localRotation, m_localScale);
+	}
+
+	void Component::Transform::SerializeLocal(CppSer::Serializer& serializer, const Vec3f& position, const Quat& rotation, const Vec3f& scale)
+	{
+		serializer << CppSer::Pair::Key << "Position" << CppSer::Pair::Value << position;
+		serializer << CppSer::Pair::Key << "Rotation" << CppSer::Pair::Value << rotation;
+		serializer << CppSer::Pair::Key << "Scale" << CppSer::Pair::Value << scale;
 	}
 
 	void Component::Transform::Deserialize(CppSer::Parser& parser)
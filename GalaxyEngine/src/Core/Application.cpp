@@ -229,9 +229,8 @@ namespace GALAXY {
 #ifdef WITH_EDITOR
 	void Core::Application::PasteObject() const
 	{
-		if (m_clipboard.empty())
+		if (m_clipboard.IsEmpty())
 			return;
-		auto parser = CppSer::Parser(m_clipboard);
 		const List<Weak<GameObject>> selected = m_editorUI->GetInspector()->GetSelectedGameObjects();
 
 		Shared<GameObject> parent;
@@ -247,19 +246,14 @@ namespace GALAXY {
 		}
 
 		m_editorUI->GetInspector()->ClearSelected();
-		// Parse all gameObject
-		do
+		for (const Shared<GameObject>& object : m_clipboard.Restore(false))
 		{
-			auto object = SceneHolder::GetCurrentScene()->CreateObject().lock();
-
-			object->SetParent(parent);
-
-			object->Deserialize(parser, false);
+			parent->AddChild(object);
+			object->FinishDeserialize();
+			object->AfterLoad();
 
 			m_editorUI->GetInspector()->AddSelected(object);
-
-			parser.PushDepth();
-		} while (parser.GetValueMap().size() != parser.GetCurrentDepth());
+		}
 	}
 
 	void Core::Application::CopyObject()
@@ -291,14 +285,13 @@ namespace GALAXY {
 				return a.lock()->GetSceneGraphID() < b.lock()->GetSceneGraphID();
 			});
 
-		auto serializer = CppSer::Serializer();
-		// Temporary : TODO : move this directly int the canBeAdded if bracket
-		for (Weak<GameObject>& object : objects)
+		List<Shared<GameObject>> lockedObjects;
+		lockedObjects.reserve(objects.size());
+		for (const Weak<GameObject>& object : objects)
 		{
-			// Serialize all GameObject in same content
-			object.lock()->Serialize(serializer);
+			lockedObjects.push_back(object.lock());
 		}
-		m_clipboard = serializer.GetContent();
+		m_clipboard = ObjectSnapshot(lockedObjects);
 	}
 #endif
 
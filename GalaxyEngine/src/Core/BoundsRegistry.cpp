@@ -0,0 +1,286 @@
+#include "pch.h"
+#include "Core/BoundsRegistry.h"
+
+#include "Core/GameObject.h"
+#include "Core/ThreadManager.h"
+
+#include "Component/MeshComponent.h"
+
+#include "Resource/Mesh.h"
+#include "Resource/Scene.h"
+
+#include "Physic/FrustumCulling.h"
+
+#include <bit>
+
+namespace GALAXY
+{
+	// Under this number of boxes every box is tested by the batch culling instead of going through the spatial index
+	constexpr size_t hierarchicalCullThreshold = 4096;
+	// Boxes tested against the occlusion buffer by a worker thread at once
+	constexpr size_t occlusionChunkSize = 1024;
+
+	void Core::BoundsRegistry::Update(const Resource::Scene* scene)
+	{
+		// The indices change below
+		m_visible.clear();
+		m_visibility.clear();
+
+		// Backward so the entry moved into a removed one was already checked
+		for (uint32_t index = static_cast<uint32_t>(m_entries.size()); index-- > 0;)
+		{
+			Component::MeshComponent* component = m_entries[index].component.Get();
+			if (component && component->GetGameObject() && component->GetGameObject()->GetScene() == scene
+				&& component->IsEnable() && !component->GetMesh().expired())
+				continue;
+			if (component)
+				component->m_boundsSlot = {};
+			Remove(index);
+		}
+
+		Component::ComponentPool<Component::MeshComponent>::ForEach([this, scene](Component::MeshComponent* component)
+			{
+				const Core::GameObject* gameObject = component->GetGameObject();
+				if (!gameObject || gameObject->GetScene() != scene || !component->IsEnable())
+					return;
+				const Shared<Resource::Mesh> mesh = component->GetMesh().lock();
+				if (!mesh || !mesh->IsLoaded())
+					return;
+
+				const Component::Transform* transform = gameObject->GetTransform();
+				const uint32_t version = transform->GetModelVersion();
+				const uint32_t index = component->m_boundsSlot.index;
+				const bool registered = index < m_entries.size() && m_entries[index].component == component->GetHandle();
+				if (registered)
+					m_entries[index].occluder = component->IsOccluder();
+				if (registered && m_entries[index].mesh == mesh.get() && m_entries[index].version == version)
+					return;
+
+				const Resource::BoundingBox localBounds = mesh->GetBoundingBox();
+				const Physic::AABB bounds = Physic::AABB(localBounds.min, localBounds.max).Transform(transform->GetModelMatrix());
+				if (!registered)
+				{
+					Add(component, mesh.get(), bounds);
+					return;
+				}
+				Entry& entry = m_entries[index];
+				entry.mesh = mesh.get();
+				entry.version = version;
+				m_bounds.Set(index, bounds);
+				m_spatialIndex.MoveProxy(entry.proxy, bounds);
+			});
+
+		m_spatialIndex.Update();
+	}
+
+	void Core::BoundsRegistry::CullViews(const List<CullView>& views)
+	{
+		ASSERT(views.size() <= maxCullViews);
+		m_currentView = 0;
+		m_visible.clear();
+		m_visibility.assign(m_entries.size(), 0);
+		CullNewViews(views.data(), static_cast<uint32_t>(std::min<size_t>(views.size(), maxCullViews)));
+	}
+
+	void Core::BoundsRegistry::Cull(const Physic::Frustum& frustum, const Mat4& viewProjection, Physic::FrustumCullCache* cache)
+	{
+		CullViews({ { frustum, viewProjection, cache } });
+	}
+
+	uint32_t Core::BoundsRegistry::AddView(const CullView& view)
+	{
+		// Nothing culled since the last update, or no bit left in the masks
+		if (m_visible.empty() || m_visible.size() == maxCullViews)
+		{
+			CullViews({ view });
+			return 0;
+		}
+		m_currentView = static_cast<uint32_t>(m_visible.size());
+		CullNewViews(&view, 1);
+		return m_currentView;
+	}
+
+	void Core::BoundsRegistry::CullNewViews(const CullView* views, const uint32_t viewCount)
+	{
+		const uint32_t firstView = static_cast<uint32_t>(m_visible.size());
+		m_visible.resize(firstView + viewCount);
+		List<Physic::Frustum> frustums(viewCount);
+		for (uint32_t view = 0; view < viewCount; view++)
+		{
+			frustums[view] = views[view].frustum;
+		}
+
+		if (m_entries.size() < hierarchicalCullThreshold)
+		{
+			Physic::FrustumCulling::CullViews(frustums.data(), viewCount, m_bounds, m_visible.data() + firstView);
+			for (uint32_t view = firstView; view < firstView + viewCount; view++)
+			{
+				for (const uint32_t index : m_visible[view])
+				{
+					m_visibility[index] |= 1u << view;
+				}
+			}
+		}
+		else
+		{
+			m_visibleProxies.resize(firstView + viewCount);
+			for (uint32_t view = firstView; view < firstView + viewCount; view++)
+			{
+				m_visibleProxies[view].clear();
+			}
+			// The cache of the camera only helps the traversal of a single frustum
+			if (viewCount == 1)
+				m_spatialIndex.CullFrustum(frustums[0], m_visibleProxies[firstView], views[0].cache);
+			for (uint32_t first = 0; viewCount > 1 && first < viewCount; first += Physic::DynamicBVH::maxCullFrustums)
+			{
+				const uint32_t count = std::min(viewCount - first, Physic::DynamicBVH::maxCullFrustums);
+				m_spatialIndex.CullFrustums(frustums.data() + first, count, m_visibleProxies.data() + firstView + first);
+			}
+			for (uint32_t view = firstView; view < firstView + viewCount; view++)
+			{
+				for (const uint32_t proxy : m_visibleProxies[view])
+				{
+					m_visibility[m_proxyEntries[proxy]] |= 1u << view;
+				}
+				m_visible[view].clear();
+			}
+			// Sorted through the visibility masks, the tree gives the proxies in no particular order
+			const uint32_t newViews = static_cast<uint32_t>(((uint64_t(1) << viewCount) - 1) << firstView);
+			for (uint32_t index = 0; index < m_visibility.size(); index++)
+			{
+				for (uint32_t mask = m_visibility[index] & newViews; mask != 0; mask &= mask - 1)
+				{
+					m_visible[std::countr_zero(mask)].push_back(index);
+				}
+			}
+		}
+
+		if (m_occlusionBuffers.size() < firstView + viewCount)
+			m_occlusionBuffers.resize(firstView + viewCount);
+		for (uint32_t view = 0; view < viewCount; view++)
+		{
+			CullOccluded(firstView + view, views[view].viewProjection);
+		}
+	}
+
+	void Core::BoundsRegistry::CullOccluded(const uint32_t view, const Mat4& viewProjection)
+	{
+		if (!m_occlusionCulling)
+			return;
+
+		if (!m_occlusionBuffers[view])
+			m_occlusionBuffers[view] = std::make_shared<Render::OcclusionBuffer>();
+		Render::OcclusionBuffer& occlusionBuffer = *m_occlusionBuffers[view];
+		List<uint32_t>& visible = m_visible[view];
+		occlusionBuffer.Begin(viewProjection);
+		for (const uint32_t index : visible)
+		{
+			const Entry& entry = m_entries[index];
+			if (!entry.occluder)
+				continue;
+			Component::MeshComponent* component = entry.component.Get();
+			const Shared<Resource::Mesh> mesh = component ? component->GetMesh().lock() : nullptr;
+			if (!mesh || mesh.get() != entry.mesh)
+				continue;
+			const std::vector<Vec3f>& positions = mesh->GetPositions();
+			occlusionBuffer.AddOccluder(positions.data(), positions.size(), component->GetTransform()->GetModelMatrix());
+		}
+		occlusionBuffer.End();
+		if (occlusionBuffer.GetTriangleCount() == 0)
+			return;
+
+		// Each chunk only writes the visibility of its own boxes
+		const uint32_t viewBit = 1u << view;
+		const size_t chunkCount = (visible.size() + occlusionChunkSize - 1) / occlusionChunkSize;
+		Core::ThreadManager::GetInstance()->ParallelFor(chunkCount, [&](const size_t chunk)
+			{
+				const size_t end = std::min(visible.size(), (chunk + 1) * occlusionChunkSize);
+				for (size_t i = chunk * occlusionChunkSize; i < end; i++)
+				{
+					const uint32_t index = visible[i];
+					if (!occlusionBuffer.IsVisible(m_bounds.Get(index)))
+						m_visibility[index] &= ~viewBit;
+				}
+			});
+		std::erase_if(visible, [&](const uint32_t index) { return (m_visibility[index] & viewBit) == 0; });
+	}
+
+	bool Core::BoundsRegistry::Raycast(const Physic::Ray& ray, RaycastHit& hit) const
+	{
+		float closestDistance = ray.scale;
+		hit.component = nullptr;
+		m_spatialIndex.Traverse([&](const Physic::AABB& bounds)
+			{
+				float distance;
+				return bounds.IntersectsRay(ray, distance) && distance <= closestDistance;
+			},
+			[&](const uint32_t proxy)
+			{
+				const Entry& entry = m_entries[m_proxyEntries[proxy]];
+				Component::MeshComponent* component = entry.component.Get();
+				const Shared<Resource::Mesh> mesh = component ? component->GetMesh().lock() : nullptr;
+				if (!mesh || mesh.get() != entry.mesh)
+					return;
+
+				// The direction is not normalized in the space of the mesh so the distances stay the same
+				const Mat4 inverseModel = component->GetTransform()->GetModelMatrix().CreateInverseMatrix();
+				const Physic::Ray localRay = { Vec3f(inverseModel * Vec4f(ray.origin, 1.f)), Vec3f(inverseModel * Vec4f(ray.direction, 0.f)), closestDistance };
+				float distance;
+				uint32_t triangle;
+				if (!mesh->GetTriangleBVH().Raycast(localRay, distance, &triangle))
+					return;
+				closestDistance = distance;
+				hit.component = component;
+				hit.distance = distance;
+				hit.triangle = triangle;
+			});
+		if (!hit.component)
+			return false;
+		hit.point = ray.origin + ray.direction * hit.distance;
+		return true;
+	}
+
+	uint32_t Core::BoundsRegistry::GetIndex(const Component::MeshComponent* component, const Resource::Mesh* mesh) const
+	{
+		const uint32_t index = component->m_boundsSlot.index;
+		if (index >= m_entries.size())
+			return INDEX_NONE;
+		const Entry& entry = m_entries[index];
+		if (entry.component != component->GetHandle() || entry.mesh != mesh
+			|| entry.version != component->GetTransform()->GetModelVersion())
+			return INDEX_NONE;
+		return index;
+	}
+
+	Component::MeshComponent* Core::BoundsRegistry::GetComponent(const uint32_t index) const
+	{
+		return m_entries[index].component.Get();
+	}
+
+	void Core::BoundsRegistry::Add(Component::MeshComponent* component, const Resource::Mesh* mesh, const Physic::AABB& bounds)
+	{
+		Entry& entry = m_entries.emplace_back();
+		entry.component = component->GetHandle();
+		entry.mesh = mesh;
+		entry.version = component->GetTransform()->GetModelVersion();
+		entry.occluder = component->IsOccluder();
+		entry.proxy = m_spatialIndex.CreateProxy(bounds, component->GetGameObject()->GetHandle());
+		component->m_boundsSlot.index = m_bounds.Add(bounds);
+		if (entry.proxy >= m_proxyEntries.size())
+			m_proxyEntries.resize(entry.proxy + 1);
+		m_proxyEntries[entry.proxy] = component->m_boundsSlot.index;
+	}
+
+	void Core::BoundsRegistry::Remove(const uint32_t index)
+	{
+		m_spatialIndex.DestroyProxy(m_entries[index].proxy);
+		m_entries[index] = m_entries.back();
+		m_entries.pop_back();
+		m_bounds.RemoveSwap(index);
+		if (index == m_entries.size())
+			return;
+		m_proxyEntries[m_entries[index].proxy] = index;
+		if (Component::MeshComponent* moved = m_entries[index].component.Get())
+			moved->m_boundsSlot.index = index;
+	}
+}
@@ -0,0 +1,124 @@
+#include "pch.h"
+#include "Core/CommandBuffer.h"
+#include "Core/GameObject.h"
+
+#include "Resource/Scene.h"
+
+namespace GALAXY
+{
+	Shared<Core::GameObject> Core::CommandBuffer::CreateObject(const String& name, const Weak<GameObject>& parent)
+	{
+		Shared<GameObject> object = GameObject::Create(name);
+		Command command;
+		command.type = CommandType::CreateObject;
+		command.parent = parent;
+		command.createdObject = object;
+		Record(std::move(command));
+		return object;
+	}
+
+	void Core::CommandBuffer::Destroy(const Weak<GameObject>& object)
+	{
+		Command command;
+		command.type = CommandType::Destroy;
+		command.object = object;
+		Record(std::move(command));
+	}
+
+	void Core::CommandBuffer::SetParent(const Weak<GameObject>& object, const Weak<GameObject>& parent)
+	{
+		Command command;
+		command.type = CommandType::SetParent;
+		command.object = object;
+		command.parent = parent;
+		Record(std::move(command));
+	}
+
+	void Core::CommandBuffer::RemoveComponent(const Weak<Component::BaseComponent>& component)
+	{
+		Command command;
+		command.type = CommandType::RemoveComponent;
+		command.component = component;
+		Record(std::move(command));
+	}
+
+	void Core::CommandBuffer::Record(Command&& command)
+	{
+		std::lock_guard lock(m_mutex);
+		m_commands.push_back(std::move(command));
+	}
+
+	void Core::CommandBuffer::Execute(Resource::Scene* scene)
+	{
+		List<Command> commands;
+		List<Shared<GameObject>> destroyed;
+		while (true)
+		{
+			{
+				std::lock_guard lock(m_mutex);
+				if (m_commands.empty())
+					break;
+				commands.swap(m_commands);
+			}
+
+			for (Command& command : commands)
+			{
+				if (command.type != CommandType::Destroy && !destroyed.empty())
+				{
+					scene->DestroyObjects(destroyed);
+					destroyed.clear();
+				}
+
+				switch (command.type)
+				{
+				case CommandType::CreateObject:
+				{
+					Shared<GameObject> parent = command.parent.lock();
+					if (!parent)
+						parent = scene->GetRootGameObject().lock();
+					parent->AddChild(command.createdObject);
+					break;
+				}
+				case CommandType::Destroy:
+					if (Shared<GameObject> object = command.object.lock())
+						destroyed.push_back(std::move(object));
+					break;
+				case CommandType::SetParent:
+				{
+					const Shared<GameObject> object = command.object.lock();
+					const Shared<GameObject> parent = command.parent.lock();
+					if (object && parent && !parent->IsAParent(object.get()) && parent != object)
+						object->SetParent(parent);
+					break;
+				}
+				case CommandType::AddComponent:
+					if (const Shared<GameObject> object = command.object.lock())
+						object->AddComponent(command.createdComponent);
+					break;
+				case CommandType::RemoveComponent:
+				{
+					const Shared<Component::BaseComponent> component = command.component.lock();
+					if (!component || !component->GetGameObject())
+						break;
+					// Skip the components already removed by something else
+					if (component->GetGameObject()->GetComponentWithIndex(component->GetIndex()).lock() == component)
+						component->RemoveFromGameObject();
+					break;
+				}
+				}
+			}
+			if (!destroyed.empty())
+			{
+				scene->DestroyObjects(destroyed);
+				destroyed.clear();
+			}
+			commands.clear();
+		}
+	}
+
+	size_t Core::CommandBuffer::GetCount() const
+	{
+		std::lock_guard lock(m_mutex);
+		return m_commands.size();
+	}
+}
@@ -4,10 +4,12 @@
 
 #include "Core/GameObject.h"
 #include "Core/SceneHolder.h"
+#include "Core/ThreadManager.h"
 
 #include "Resource/Scene.h"
 
 #include "Component/ComponentHolder.h"
+#include "Component/ScriptComponent.h"
 
 using namespace Core;
 using namespace Component;
@@ -15,8 +17,7 @@ namespace GALAXY
 {
 	GameObject::GameObject()
 	{
-		m_transform = std::make_unique<Component::Transform>();
-		m_transform->SetGameObject(this);
+		m_transform.SetGameObject(this);
 	}
 
 	GameObject::GameObject(const String& name) : GameObject()
@@ -26,6 +27,7 @@ namespace GALAXY
 
 	GameObject::~GameObject()
 	{
+		m_handle.Release(GetHandleTable());
 		for (size_t i = 0; m_components.size(); i++)
 		{
 			m_components[i]->RemoveFromGameObject();
@@ -46,6 +48,7 @@ namespace GALAXY
 
 		if (m_scene)
 			m_scene->RemoveObject(this);
+		ClearTickRegistration();
 	}
 
 	void GameObject::AddChild(const Shared<GameObject>& child, const uint32_t index /*= -1*/)
@@ -55,14 +58,20 @@ namespace GALAXY
 		if (!child)
 			return;
 		// Check if the object is already on the list
-		if (std::ranges::count_if(m_children, [&](const Shared<GameObject>& c)
-			{ return c == child; }) == 0)
+		if (child->m_childIndex >= m_children.size() || m_children[child->m_childIndex] != child)
 		{
 			// if the index is not set, add the child at the end of the list
 			if (index != INDEX_NONE)
+			{
 				m_children.insert(m_children.begin() + index, child);
+				UpdateChildIndices(index);
+			}
 			else
+			{
+				child->m_childIndex = static_cast<uint32_t>(m_children.size());
 				m_children.push_back(child);
+			}
+			OnChildrenChanged();
 		}
 		// Check if the current object is already a parent of the child
 		if (child->m_parent.lock().get() != this)
@@ -75,6 +84,24 @@ namespace GALAXY
 
 	}
 
+	void GameObject::AddChildren(const List<Shared<GameObject>>& children)
+	{
+		if (children.empty())
+			return;
+		m_children.reserve(m_children.size() + children.size());
+		for (const Shared<GameObject>& child : children)
+		{
+			ASSERT(!child->m_parent.lock() && !child->m_scene);
+			child->m_parent = weak_from_this();
+			child->m_childIndex = static_cast<uint32_t>(m_children.size());
+			m_children.push_back(child);
+		}
+		OnChildrenChanged();
+
+		if (m_scene)
+			m_scene->AddObjects(children);
+	}
+
 	void GameObject::SetParent(const Weak<GameObject>& parent)
 	{
 		if (!parent.lock())
@@ -89,25 +116,41 @@ namespace GALAXY
 
 	void GameObject::RemoveChild(const GameObject* child)
 	{
-		std::erase_if(m_children, [&](const Weak<GameObject>& c) {
-			return c.lock().get() == child;
-			});
+		RemoveChild(GetChildIndex(child));
 	}
 
 	void GameObject::RemoveChild(const uint32_t index)
 	{
-		if (index < m_children.size())
-			m_children.erase(m_children.begin() + index);
+		if (index >= m_children.size())
+			return;
+		m_children[index]->m_childIndex = INDEX_NONE;
+		if (index + 1 < m_children.size())
+		{
+			m_children[index] = std::move(m_children.back());
+			m_children[index]->m_childIndex = index;
+		}
+		m_children.pop_back();
+		OnChildrenChanged();
+	}
+
+	void GameObject::UpdateChildIndices(const uint32_t first)
+	{
+		for (uint32_t i = first; i < m_children.size(); i++)
+		{
+			m_children[i]->m_childIndex = i;
+		}
 	}
 
 	void GameObject::UpdateSelfAndChild() const
 	{
-		m_transform->OnUpdate();
+		m_transform.OnUpdate();
 		for (const auto& m_component : m_components)
 		{
 			if (m_component->IsEnable()) {
-				m_component->OnUpdate();
-				m_component->OnEditorUpdate();
+				if (m_component->IsTickEnabled(TickFlag::Update))
+					m_component->OnUpdate();
+				if (m_component->IsTickEnabled(TickFlag::EditorUpdate))
+					m_component->OnEditorUpdate();
 			}
 		}
 
@@ -121,7 +164,7 @@ namespace GALAXY
 	{
 		for (const auto& m_component : m_components)
 		{
-			if (m_component->IsEnable()) {
+			if (m_component->IsEnable() && m_component->IsTickEnabled(TickFlag::Draw)) {
 				switch (drawMode)
 				{
 				case DrawMode::Editor:
@@ -145,13 +188,24 @@ namespace GALAXY
 
 	uint32_t GameObject::GetChildIndex(const GameObject* child) const
 	{
+		if (!child)
+			return INDEX_NONE;
+		if (child->m_childIndex < m_children.size() && m_children[child->m_childIndex].get() == child)
+			return child->m_childIndex;
+
+		// The stored index is only missing if the children were set without AddChild
+		if (child->m_parent.lock().get() != this)
+			return INDEX_NONE;
 		for (uint32_t i = 0; i < m_children.size(); i++)
 		{
 			if (m_children[i].get() == child)
+			{
+				child->m_childIndex = i;
 				return i;
+			}
 		}
 		// Not found
-		return -1;
+		return INDEX_NONE;
 	}
 
 	bool GameObject::IsSibling(const List<Weak<GameObject>>& siblings) const
@@ -167,12 +221,16 @@ namespace GALAXY
 	void GameObject::RemoveComponent(Component::BaseComponent* component)
 	{
 		component->OnDestroy();
+		component->ClearTickRegistration();
 		const uint32_t index = component->GetIndex();
 		m_components.erase(m_components.begin() + index);
-		for (uint32_t i = index; i < m_components.size(); i++)
+		m_componentMask = 0;
+		for (uint32_t i = 0; i < m_components.size(); i++)
 		{
 			m_components[i]->p_id = i;
+			m_componentMask |= m_components[i]->GetTypeMask();
 		}
+		SetModified();
 	}
 
 	void GameObject::ChangeComponentIndex(uint32_t prevIndex, uint32_t newIndex)
@@ -184,20 +242,58 @@ namespace GALAXY
 			m_components.insert(m_components.begin() + newIndex, std::move(elementToMove));
 			m_components[newIndex]->p_id = newIndex;
 			m_components[prevIndex]->p_id = prevIndex;
+			SetModified();
 		}
 	}
 
+	HandleTable& GameObject::GetHandleTable()
+	{
+		static HandleTable table;
+		return table;
+	}
+
+	void GameObject::SetSceneGraphID(const uint64_t id)
+	{
+		const uint64_t previousID = m_sceneGraphID;
+		m_sceneGraphID = id;
+		if (m_scene)
+			m_scene->OnSceneGraphIDChanged(this, previousID);
+	}
+
+	void GameObject::SetModified()
+	{
+		m_generation++;
+		if (m_scene)
+			m_scene->MarkModified(this);
+	}
+
+	void GameObject::OnChildrenChanged()
+	{
+		SetModified();
+		if (m_scene)
+			m_scene->GetTransformHierarchy()->SetStructureDirty();
+	}
+
 	Component::BaseComponent* GameObject::GetComponentWithName(const String& componentName) const
 	{
 		for (const Shared<Component::BaseComponent>& component : m_components)
 		{
-			std::set<const char*> names = component->GetComponentNames();
-			for (const auto& curComponentName : names)
-			{
-				if (componentName == curComponentName) {
-					return component.get();
-				}
-			}
+			if (componentName == component->GetComponentName())
+				return component.get();
+		}
+		if (m_components.empty())
+			return nullptr;
+		if (componentName == m_components[0]->BaseComponent::GetComponentName())
+			return m_components[0].get();
+
+		// Name of a type the components derive from
+		const Component::ComponentMask bit = Component::ComponentTypes::GetBitWithName(componentName);
+		if ((m_componentMask & bit) == 0)
+			return nullptr;
+		for (const Shared<Component::BaseComponent>& component : m_components)
+		{
+			if (component->GetTypeMask() & bit)
+				return component.get();
 		}
 		return nullptr;
 	}
@@ -220,15 +316,15 @@ namespace GALAXY
 
 	Shared<GameObject> GameObject::Clone() const
 	{
-		Shared<GameObject> clone = std::make_shared<GameObject>();
+		Shared<GameObject> clone = GameObject::Create();
 		clone->m_name = m_name;
-		clone->m_scene = m_scene;
 		clone->m_parent = {};
 		clone->m_children.resize(m_children.size());
 		for (size_t i = 0; i < m_children.size(); i++)
 		{
 			clone->m_children[i] = m_children[i]->Clone();
 			clone->m_children[i]->m_parent = clone;
+			clone->m_children[i]->m_childIndex = static_cast<uint32_t>(i);
 		}
 		clone->m_components.resize(m_components.size());
 		for (size_t i = 0; i < m_components.size(); i++)
@@ -236,9 +332,66 @@ namespace GALAXY
 			clone->m_components[i] = m_components[i]->Clone();
 			clone->m_components[i]->p_gameObject = clone.get();
 		}
+		clone->m_componentMask = m_componentMask;
 		return clone;
 	}
 
+	List<Shared<GameObject>> GameObject::CloneMany(const size_t count, const List<InstanceTransform>& transforms) const
+	{
+		ASSERT(transforms.empty() || transforms.size() == count);
+
+		// Parents are always before their children, and siblings are next to each other in their order
+		struct Node
+		{
+			const GameObject* source;
+			uint32_t parent;
+		};
+		List<Node> nodes = { { this, INDEX_NONE } };
+		for (size_t i = 0; i < nodes.size(); i++)
+		{
+			for (const Shared<GameObject>& child : nodes[i].source->m_children)
+				nodes.push_back({ child.get(), static_cast<uint32_t>(i) });
+		}
+
+		List<Shared<GameObject>> clones(count);
+		Core::ThreadManager::GetInstance()->ParallelFor(count, [&](const size_t instance)
+			{
+				List<GameObject*> objects(nodes.size());
+				for (size_t i = 0; i < nodes.size(); i++)
+				{
+					const GameObject* source = nodes[i].source;
+					Shared<GameObject> object = Create();
+					object->m_name = source->m_name;
+					object->m_active = source->m_active;
+					const bool hasTransform = i == 0 && !transforms.empty();
+					object->m_transform.SetLocalPosition(hasTransform ? transforms[instance].position : source->m_transform.GetLocalPosition());
+					object->m_transform.SetLocalRotation(hasTransform ? transforms[instance].rotation : source->m_transform.GetLocalRotation());
+					object->m_transform.SetLocalScale(hasTransform ? transforms[instance].scale : source->m_transform.GetLocalScale());
+
+					object->m_components.reserve(source->m_components.size());
+					for (const Shared<Component::BaseComponent>& component : source->m_components)
+					{
+						object->m_components.push_back(component->Clone());
+						object->m_components.back()->p_gameObject = object.get();
+					}
+					object->m_componentMask = source->m_componentMask;
+					object->m_children.reserve(source->m_children.size());
+
+					objects[i] = object.get();
+					if (i == 0)
+					{
+						clones[instance] = std::move(object);
+						continue;
+					}
+					GameObject* parent = objects[nodes[i].parent];
+					object->m_parent = parent->weak_from_this();
+					object->m_childIndex = static_cast<uint32_t>(parent->m_children.size());
+					parent->m_children.push_back(std::move(object));
+				}
+			});
+		return clones;
+	}
+
 	void GameObject::AfterLoad() const
 	{
 		for (const Shared<Component::BaseComponent>& component : m_components)
@@ -253,50 +406,64 @@ namespace GALAXY
 
 	List<Weak<GameObject>> GameObject::GetAllChildren() const
 	{
-		List<Weak<GameObject>> children = GetChildren();
-		for (auto& child : m_children)
+		List<Weak<GameObject>> children;
+		AppendAllChildren(children);
+		return children;
+	}
+
+	void GameObject::AppendAllChildren(List<Weak<GameObject>>& children) const
+	{
+		children.insert(children.end(), m_children.begin(), m_children.end());
+		for (const Shared<GameObject>& child : m_children)
 		{
-			List<Weak<GameObject>> newChild = child->GetAllChildren();
-			children.insert(children.end(), newChild.begin(), newChild.end());
+			child->AppendAllChildren(children);
 		}
-		return children;
 	}
 
-	void SerializeTransform(CppSer::Serializer& serializer, Component::Transform* transform)
+	void SerializeTransform(CppSer::Serializer& serializer, const Vec3f& position, const Quat& rotation, const Vec3f& scale)
 	{
 		serializer << CppSer::Pair::BeginMap << "BEGIN TRANSFORM";
-		transform->Serialize(serializer);
+		Component::Transform::SerializeLocal(serializer, position, rotation, scale);
 		serializer << CppSer::Pair::EndMap << "END TRANSFORM";
 	}
 
-	void SerializeComponent(CppSer::Serializer& serializer, const Shared<Component::BaseComponent>& components)
+	void SerializeComponent(CppSer::Serializer& serializer, const Shared<Component::BaseComponent>& components, const bool enable)
 	{
 		serializer << CppSer::Pair::BeginMap << "BEGIN COMPONENT";
 		serializer << CppSer::Pair::Key << "Name" << CppSer::Pair::Value << components->GetComponentName();
-		serializer << CppSer::Pair::Key << "Enable" << CppSer::Pair::Value << components->IsEnable();
+		serializer << CppSer::Pair::Key << "Enable" << CppSer::Pair::Value << enable;
 		components->Serialize(serializer);
 		serializer << CppSer::Pair::EndMap << "END COMPONENT";
 	}
 
-	void GameObject::Serialize(CppSer::Serializer& serializer)
+	void SerializeObjectValues(CppSer::Serializer& serializer, const String& name, const bool active, const UUID& uuid, const size_t componentCount, const size_t childCount)
 	{
 		serializer << CppSer::Pair::BeginMap << "BEGIN GAMEOBJECT";
 
-		serializer << CppSer::Pair::Key << "Name" << CppSer::Pair::Value << m_name;
-		serializer << CppSer::Pair::Key << "Active" << CppSer::Pair::Value << m_active;
-		serializer << CppSer::Pair::Key << "UUID" << CppSer::Pair::Value << m_UUID;
+		serializer << CppSer::Pair::Key << "Name" << CppSer::Pair::Value << name;
+		serializer << CppSer::Pair::Key << "Active" << CppSer::Pair::Value << active;
+		serializer << CppSer::Pair::Key << "UUID" << CppSer::Pair::Value << uuid;
 
-		serializer << CppSer::Pair::Key << "Component Number" << CppSer::Pair::Value << (unsigned long long)m_components.size();
-		serializer << CppSer::Pair::Key << "Child Number" << CppSer::Pair::Value << (unsigned long long)m_children.size();
+		serializer << CppSer::Pair::Key << "Component Number" << CppSer::Pair::Value << (unsigned long long)componentCount;
+		serializer << CppSer::Pair::Key << "Child Number" << CppSer::Pair::Value << (unsigned long long)childCount;
+	}
 
-		SerializeTransform(serializer, m_transform.get());
+	void GameObject::SerializeHead(CppSer::Serializer& serializer)
+	{
+		SerializeObjectValues(serializer, m_name, m_active, m_UUID, m_components.size(), m_children.size());
+		SerializeTransform(serializer, m_transform.GetLocalPosition(), m_transform.GetLocalRotation(), m_transform.GetLocalScale());
 
 		serializer << CppSer::Pair::BeginTab;
 		for (Shared<Component::BaseComponent>& component : m_components)
 		{
-			SerializeComponent(serializer, component);
+			SerializeComponent(serializer, component, component->IsEnable());
 		}
 		serializer << CppSer::Pair::EndTab;
+	}
+
+	void GameObject::Serialize(CppSer::Serializer& serializer)
+	{
+		SerializeHead(serializer);
 
 		serializer << CppSer::Pair::BeginTab;
 		for (const Shared<GameObject>& child : m_children)
@@ -308,7 +475,117 @@ namespace GALAXY
 		serializer << CppSer::Pair::EndMap << "END GAMEOBJECT";
 	}
 
+	void GameObject::GetSerializedChunks(List<Shared<const String>>& chunks, List<SerializedCopy>& copies, const size_t depth)
+	{
+		Shared<const String> footer = m_serializedFooter;
+		size_t copyIndex = INDEX_NONE;
+		// The scripts write their variables directly, their objects are serialized every time.
+		// Their variables are only safe to read here, on the main thread
+		if (HasComponent<Component::ScriptComponent>())
+		{
+			CppSer::Serializer serializer;
+			for (size_t i = 0; i < depth; i++)
+				serializer << CppSer::Pair::BeginTab;
+
+			SerializeHead(serializer);
+			String head = serializer.GetContent();
+
+			serializer << CppSer::Pair::EndMap << "END GAMEOBJECT";
+			footer = std::make_shared<const String>(serializer.GetContent().substr(head.size()));
+			chunks.push_back(std::make_shared<const String>(std::move(head)));
+		}
+		else if (m_serializedGeneration != m_generation || m_serializedDepth != depth)
+		{
+			copyIndex = copies.size();
+			SerializedCopy& copy = copies.emplace_back();
+			copy.object = weak_from_this();
+			copy.generation = m_generation;
+			copy.depth = depth;
+			copy.headChunk = chunks.size();
+			copy.name = m_name;
+			copy.uuid = m_UUID;
+			copy.active = m_active;
+			copy.childCount = m_children.size();
+			copy.position = m_transform.GetLocalPosition();
+			copy.rotation = m_transform.GetLocalRotation();
+			copy.scale = m_transform.GetLocalScale();
+			copy.components.reserve(m_components.size());
+			for (const Shared<Component::BaseComponent>& component : m_components)
+			{
+				// Out of the component pools, the copy is only read by the saving thread
+				Shared<Component::BaseComponent> clone = component->CloneDetached();
+				clone->p_gameObject = nullptr;
+				copy.components.emplace_back(std::move(clone), component->IsEnable());
+			}
+			chunks.emplace_back();
+		}
+		else
+		{
+			chunks.push_back(m_serializedHead);
+		}
+
+		for (const Shared<GameObject>& child : m_children)
+		{
+			child->GetSerializedChunks(chunks, copies, depth + 1);
+		}
+
+		if (copyIndex != INDEX_NONE)
+		{
+			copies[copyIndex].footerChunk = chunks.size();
+			chunks.emplace_back();
+		}
+		else
+		{
+			chunks.push_back(std::move(footer));
+		}
+	}
+
+	void GameObject::WriteSerializedCopy(SerializedCopy& copy)
+	{
+		CppSer::Serializer serializer;
+		for (size_t i = 0; i < copy.depth; i++)
+			serializer << CppSer::Pair::BeginTab;
+
+		SerializeObjectValues(serializer, copy.name, copy.active, copy.uuid, copy.components.size(), copy.childCount);
+		SerializeTransform(serializer, copy.position, copy.rotation, copy.scale);
+
+		serializer << CppSer::Pair::BeginTab;
+		for (const auto& [component, enable] : copy.components)
+		{
+			SerializeComponent(serializer, component, enable);
+		}
+		serializer << CppSer::Pair::EndTab;
+		String head = serializer.GetContent();
+
+		serializer << CppSer::Pair::EndMap << "END GAMEOBJECT";
+		copy.footer = std::make_shared<const String>(serializer.GetContent().substr(head.size()));
+		copy.head = std::make_shared<const String>(std::move(head));
+	}
+
+	void GameObject::CacheSerializedCopy(const SerializedCopy& copy)
+	{
+		const Shared<GameObject> object = copy.object.lock();
+		if (!object || !copy.head || object->m_generation != copy.generation)
+			return;
+		object->m_serializedHead = copy.head;
+		object->m_serializedFooter = copy.footer;
+		object->m_serializedGeneration = copy.generation;
+		object->m_serializedDepth = copy.depth;
+	}
+
 	void GameObject::Deserialize(CppSer::Parser& parser, const bool parseUUID /*= true*/)
+	{
+		DeserializeDetached(parser, parseUUID);
+		FinishDeserialize();
+		if (!m_scene)
+			return;
+		for (const Shared<GameObject>& child : m_children)
+		{
+			m_scene->AddObject(child);
+		}
+	}
+
+	size_t GameObject::DeserializeHead(CppSer::Parser& parser, const bool parseUUID)
 	{
 		m_name = parser["Name"];
 		m_active = parser["Active"].As<bool>();
@@ -316,54 +593,96 @@ namespace GALAXY
 			m_UUID = parser["UUID"].As<uint64_t>();
 
 		const size_t componentNumber = parser["Component Number"].As<size_t>();
-		m_children.resize(parser["Child Number"].As<size_t>());
+		const size_t childNumber = parser["Child Number"].As<size_t>();
 
 		parser.PushDepth();
-		m_transform->Deserialize(parser);
-		m_transform->SetGameObject(this);
+		m_transform.Deserialize(parser);
+		m_transform.SetGameObject(this);
 
 		for (size_t i = 0; i < componentNumber; i++)
 		{
 			parser.PushDepth();
 			Shared<Component::BaseComponent> component;
-			String componentNameString = parser["Name"];
+			const String componentName = parser["Name"];
 			const bool enable = parser["Enable"].As<bool>();
-			const char* componentName = componentNameString.c_str();
-			for (const Shared<BaseComponent>& componentInstance : Component::ComponentHolder::GetList())
-			{
-				const char* thisComponentName = componentInstance->GetComponentName();
-				if (!strcmp(thisComponentName, componentName))
-				{
-					component = componentInstance->Clone();
-					break;
-				}
-			}
+			if (const Shared<BaseComponent> componentInstance = Component::ComponentHolder::GetWithName(componentName))
+				component = componentInstance->Clone();
 			if (component) {
 				component->SetSelfEnable(enable);
 				component->Deserialize(parser);
-				AddComponent(component);
+				AttachComponent(component);
 			}
 		}
+		return childNumber;
+	}
+
+	void GameObject::AttachComponent(const Shared<Component::BaseComponent>& component)
+	{
+		component->SetGameObject(this);
+		m_components.push_back(component);
+		m_componentMask |= component->GetTypeMask();
+		component->p_id = static_cast<uint32_t>(m_components.size() - 1);
+		component->UpdateTickRegistration();
+	}
+
+	void GameObject::DeserializeDetached(CppSer::Parser& parser, const bool parseUUID /*= true*/)
+	{
+		m_children.resize(DeserializeHead(parser, parseUUID));
 
 		for (Shared<GameObject>& child : m_children)
 		{
 			parser.PushDepth();
 
-			child = std::make_shared<GameObject>();
+			child = GameObject::Create();
+			child->DeserializeDetached(parser, parseUUID);
+		}
+		UpdateChildIndices();
+	}
+
+	void GameObject::FinishDeserialize()
+	{
+		for (const Shared<GameObject>& child : m_children)
+		{
+			child->m_parent = weak_from_this();
 			child->m_scene = m_scene;
-			child->SetParent(weak_from_this());
-			child->Deserialize(parser, parseUUID);
-			m_scene->AddObject(child);
+		}
+
+		// A component can remove itself during its creation
+		const List<Shared<Component::BaseComponent>> components = m_components;
+		for (const Shared<Component::BaseComponent>& component : components)
+		{
+			component->OnCreate();
+		}
+
+		for (const Shared<GameObject>& child : m_children)
+		{
+			child->FinishDeserialize();
 		}
 	}
 
 	void GameObject::SetScene(Resource::Scene* scene)
 	{
 		m_scene = scene;
+		for (const Shared<Component::BaseComponent>& component : m_components)
+		{
+			component->UpdateTickRegistration();
+		}
 		for (Shared<GameObject>& child : m_children)
 		{
 			child->SetScene(scene);
 		}
 	}
 
+	void GameObject::ClearTickRegistration() const
+	{
+		for (const Shared<Component::BaseComponent>& component : m_components)
+		{
+			component->ClearTickRegistration();
+		}
+		for (const Shared<GameObject>& child : m_children)
+		{
+			child->ClearTickRegistration();
+		}
+	}
+
 }
@@ -0,0 +1,44 @@
+#include "pch.h"
+#include "Core/Handle.h"
+
+namespace GALAXY
+{
+	Core::HandleTable::~HandleTable()
+	{
+		for (std::atomic<Slot*>& chunk : m_chunks)
+		{
+			delete[] chunk.load();
+		}
+	}
+
+	uint32_t Core::HandleTable::Add(void* object, uint32_t& generation)
+	{
+		std::lock_guard lock(m_mutex);
+		uint32_t index;
+		if (!m_freeSlots.empty())
+		{
+			index = m_freeSlots.back();
+			m_freeSlots.pop_back();
+		}
+		else
+		{
+			index = m_size++;
+			ASSERT(index >> chunkBits < maxChunkCount);
+			if ((index & (chunkSize - 1)) == 0)
+				m_chunks[index >> chunkBits].store(new Slot[chunkSize], std::memory_order_release);
+		}
+		Slot& slot = m_chunks[index >> chunkBits].load(std::memory_order_relaxed)[index & (chunkSize - 1)];
+		generation = slot.generation.load(std::memory_order_relaxed);
+		slot.object.store(object, std::memory_order_release);
+		return index;
+	}
+
+	void Core::HandleTable::Remove(const uint32_t index)
+	{
+		std::lock_guard lock(m_mutex);
+		Slot& slot = m_chunks[index >> chunkBits].load(std::memory_order_relaxed)[index & (chunkSize - 1)];
+		slot.object.store(nullptr, std::memory_order_relaxed);
+		slot.generation.fetch_add(1, std::memory_order_release);
+		m_freeSlots.push_back(index);
+	}
+}
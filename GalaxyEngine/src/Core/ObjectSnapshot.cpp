@@ -0,0 +1,192 @@
+#include "pch.h"
+#include "Core/ObjectSnapshot.h"
+#include "Core/GameObject.h"
+
+#include "Component/ComponentHolder.h"
+
+#include "Utils/Compression.h"
+
+// Layout : component payload count, payloads, root count, objects
+// Object : name, uuid, active, local position, rotation and scale, components (enable, payload index), children
+namespace GALAXY {
+	template<typename T>
+	static void Write(std::vector<uint8_t>& data, const T& value)
+	{
+		static_assert(std::is_trivially_copyable_v<T>);
+		const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+		data.insert(data.end(), bytes, bytes + sizeof(T));
+	}
+
+	static void WriteString(std::vector<uint8_t>& data, const String& value)
+	{
+		Write<uint32_t>(data, static_cast<uint32_t>(value.size()));
+		data.insert(data.end(), value.begin(), value.end());
+	}
+
+	struct Core::ObjectSnapshot::Reader
+	{
+		const std::vector<uint8_t>& data;
+		size_t position = 0;
+
+		template<typename T>
+		T Read()
+		{
+			T value;
+			std::memcpy(&value, data.data() + position, sizeof(T));
+			position += sizeof(T);
+			return value;
+		}
+
+		String ReadString()
+		{
+			const uint32_t size = Read<uint32_t>();
+			String value(reinterpret_cast<const char*>(data.data()) + position, size);
+			position += size;
+			return value;
+		}
+	};
+
+	Core::ObjectSnapshot::ObjectSnapshot(const List<Shared<GameObject>>& objects)
+	{
+		PROFILE_SCOPE_LOG("ObjectSnapshot::ObjectSnapshot");
+		List<String> payloads;
+		UMap<String, uint32_t> payloadIndices;
+
+		std::vector<uint8_t> objectData;
+		Write<uint32_t>(objectData, static_cast<uint32_t>(objects.size()));
+		for (const Shared<GameObject>& object : objects)
+		{
+			WriteObject(objectData, object.get(), payloads, payloadIndices);
+		}
+
+		Write<uint32_t>(m_data, static_cast<uint32_t>(payloads.size()));
+		for (const String& payload : payloads)
+		{
+			WriteString(m_data, payload);
+		}
+		m_data.insert(m_data.end(), objectData.begin(), objectData.end());
+		m_data.shrink_to_fit();
+		m_rawSize = m_data.size();
+	}
+
+	void Core::ObjectSnapshot::WriteObject(std::vector<uint8_t>& data, GameObject* object, List<String>& payloads, UMap<String, uint32_t>& payloadIndices)
+	{
+		WriteString(data, object->m_name);
+		Write<uint64_t>(data, object->m_UUID);
+		Write<uint8_t>(data, object->m_active);
+
+		const Component::Transform* transform = object->GetTransform();
+		const Vec3f position = transform->GetLocalPosition();
+		const Quat rotation = transform->GetLocalRotation();
+		const Vec3f scale = transform->GetLocalScale();
+		for (const float value : { position.x, position.y, position.z, rotation.x, rotation.y, rotation.z, rotation.w, scale.x, scale.y, scale.z })
+			Write<float>(data, value);
+
+		Write<uint32_t>(data, static_cast<uint32_t>(object->m_components.size()));
+		for (const Shared<Component::BaseComponent>& component : object->m_components)
+		{
+			CppSer::Serializer serializer;
+			serializer << CppSer::Pair::BeginMap << "BEGIN COMPONENT";
+			serializer << CppSer::Pair::Key << "Name" << CppSer::Pair::Value << component->GetComponentName();
+			component->Serialize(serializer);
+			serializer << CppSer::Pair::EndMap << "END COMPONENT";
+
+			// Components with the same values share the same payload
+			auto [it, inserted] = payloadIndices.try_emplace(serializer.GetContent(), static_cast<uint32_t>(payloads.size()));
+			if (inserted)
+				payloads.push_back(it->first);
+
+			Write<uint8_t>(data, component->IsSelfEnable());
+			Write<uint32_t>(data, it->second);
+		}
+
+		Write<uint32_t>(data, static_cast<uint32_t>(object->m_children.size()));
+		for (const Shared<GameObject>& child : object->m_children)
+		{
+			WriteObject(data, child.get(), payloads, payloadIndices);
+		}
+	}
+
+	List<Shared<Core::GameObject>> Core::ObjectSnapshot::Restore(const bool keepUUID) const
+	{
+		PROFILE_SCOPE_LOG("ObjectSnapshot::Restore");
+		if (m_data.empty())
+			return {};
+
+		std::vector<uint8_t> decompressedData;
+		if (m_compressed && !Utils::Compression::Decompress(m_data.data(), m_data.size(), m_rawSize, decompressedData))
+		{
+			PrintError("Corrupted object snapshot");
+			return {};
+		}
+		Reader reader{ m_compressed ? decompressedData : m_data };
+
+		// Deserialize each distinct component once, the objects get a clone of it
+		const uint32_t payloadCount = reader.Read<uint32_t>();
+		List<Shared<Component::BaseComponent>> prototypes(payloadCount);
+		for (Shared<Component::BaseComponent>& prototype : prototypes)
+		{
+			CppSer::Parser parser(reader.ReadString());
+			if (const Shared<Component::BaseComponent> componentInstance = Component::ComponentHolder::GetWithName(parser["Name"]))
+			{
+				prototype = componentInstance->Clone();
+				prototype->Deserialize(parser);
+			}
+		}
+
+		List<Shared<GameObject>> objects(reader.Read<uint32_t>());
+		for (Shared<GameObject>& object : objects)
+		{
+			object = ReadObject(reader, prototypes, keepUUID);
+		}
+		return objects;
+	}
+
+	Shared<Core::GameObject> Core::ObjectSnapshot::ReadObject(Reader& reader, const List<Shared<Component::BaseComponent>>& prototypes, const bool keepUUID)
+	{
+		Shared<GameObject> object = GameObject::Create(reader.ReadString());
+		const uint64_t uuid = reader.Read<uint64_t>();
+		if (keepUUID)
+			object->m_UUID = uuid;
+		object->m_active = reader.Read<uint8_t>();
+
+		Component::Transform* transform = object->GetTransform();
+		Vec3f position, scale;
+		Quat rotation;
+		for (float* value : { &position.x, &position.y, &position.z, &rotation.x, &rotation.y, &rotation.z, &rotation.w, &scale.x, &scale.y, &scale.z })
+			*value = reader.Read<float>();
+		transform->SetLocalPosition(position);
+		transform->SetLocalRotation(rotation);
+		transform->SetLocalScale(scale);
+
+		const uint32_t componentCount = reader.Read<uint32_t>();
+		for (uint32_t i = 0; i < componentCount; i++)
+		{
+			const bool enable = reader.Read<uint8_t>();
+			const Shared<Component::BaseComponent>& prototype = prototypes[reader.Read<uint32_t>()];
+			if (!prototype)
+				continue;
+			const Shared<Component::BaseComponent> component = prototype->Clone();
+			component->SetSelfEnable(enable);
+			object->AttachComponent(component);
+		}
+
+		object->m_children.resize(reader.Read<uint32_t>());
+		for (Shared<GameObject>& child : object->m_children)
+		{
+			child = ReadObject(reader, prototypes, keepUUID);
+			child->m_parent = object;
+		}
+		object->UpdateChildIndices();
+		return object;
+	}
+
+	void Core::ObjectSnapshot::Compress()
+	{
+		if (m_compressed || m_data.empty())
+			return;
+		m_data = Utils::Compression::Compress(m_data.data(), m_data.size());
+		m_data.shrink_to_fit();
+		m_compressed = true;
+	}
+}
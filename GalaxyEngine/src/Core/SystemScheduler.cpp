@@ -0,0 +1,146 @@
+#include "pch.h"
+#include "Core/SystemScheduler.h"
+#include "Core/ThreadManager.h"
+
+#include "Utils/FileSystem.h"
+
+#include <iomanip>
+#include <sstream>
+
+namespace GALAXY
+{
+	Core::SystemScheduler::SystemBuilder Core::SystemScheduler::AddSystem(const String& name, SystemFunction function)
+	{
+		System& system = m_systems.emplace_back();
+		system.name = name;
+		system.function = std::move(function);
+		m_dirty = true;
+		return { this, static_cast<uint32_t>(m_systems.size() - 1) };
+	}
+
+	void Core::SystemScheduler::RemoveSystem(const String& name)
+	{
+		if (std::erase_if(m_systems, [&](const System& system) { return system.name == name; }) > 0)
+			m_dirty = true;
+	}
+
+	bool Core::SystemScheduler::Conflict(const System& a, const System& b)
+	{
+		if (a.writeAll || b.writeAll)
+			return true;
+		const auto intersect = [](const List<std::type_index>& first, const List<std::type_index>& second)
+			{
+				return std::ranges::any_of(first, [&](const std::type_index& type) { return std::ranges::find(second, type) != second.end(); });
+			};
+		return intersect(a.writes, b.writes) || intersect(a.writes, b.reads) || intersect(a.reads, b.writes);
+	}
+
+	void Core::SystemScheduler::Build()
+	{
+		m_stages.clear();
+		List<uint32_t> systemStages(m_systems.size(), 0);
+		for (uint32_t i = 0; i < m_systems.size(); i++)
+		{
+			System& system = m_systems[i];
+			system.dependencies.clear();
+			uint32_t stage = 0;
+			for (uint32_t j = 0; j < i; j++)
+			{
+				if (!Conflict(system, m_systems[j]))
+					continue;
+				system.dependencies.push_back(j);
+				stage = std::max(stage, systemStages[j] + 1);
+			}
+			systemStages[i] = stage;
+			if (stage >= m_stages.size())
+				m_stages.resize(stage + 1);
+			m_stages[stage].push_back(i);
+		}
+		m_dirty = false;
+	}
+
+	void Core::SystemScheduler::RunSystem(System& system)
+	{
+		const auto start = std::chrono::high_resolution_clock::now();
+		system.function();
+		system.duration = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+	}
+
+	void Core::SystemScheduler::Run()
+	{
+		if (m_dirty)
+			Build();
+		for (const List<uint32_t>& stage : m_stages)
+		{
+			RunStage(stage);
+		}
+	}
+
+	void Core::SystemScheduler::RunStage(const List<uint32_t>& stage)
+	{
+		ThreadManager* threadManager = ThreadManager::GetInstance();
+
+		List<System*> workerSystems;
+		List<System*> mainThreadSystems;
+		for (const uint32_t index : stage)
+		{
+			System& system = m_systems[index];
+			if (system.mainThread || !m_parallel || threadManager->GetThreadCount() == 0)
+				mainThreadSystems.push_back(&system);
+			else
+				workerSystems.push_back(&system);
+		}
+		// The worker systems start first, the main thread systems of the stage run beside them
+		// then the calling thread takes part in the worker systems left
+		threadManager->ParallelFor(workerSystems.size(), [&](const size_t index)
+			{
+				RunSystem(*workerSystems[index]);
+			}, [&]()
+			{
+				for (System* system : mainThreadSystems)
+				{
+					RunSystem(*system);
+				}
+			});
+	}
+
+	String Core::SystemScheduler::GetGraph()
+	{
+		if (m_dirty)
+			Build();
+
+		std::ostringstream graph;
+		graph << std::fixed << std::setprecision(3);
+		graph << "digraph Schedule {\n\trankdir=LR;\n";
+		for (uint32_t stage = 0; stage < m_stages.size(); stage++)
+		{
+			graph << "\tsubgraph cluster_" << stage << " {\n\t\tlabel=\"Stage " << stage << "\";\n";
+			for (const uint32_t index : m_stages[stage])
+			{
+				const System& system = m_systems[index];
+				graph << "\t\tsystem" << index << " [shape=box, label=\"" << system.name << "\\n" << system.duration << " ms";
+				if (system.mainThread)
+					graph << "\\nmain thread";
+				graph << "\"];\n";
+			}
+			graph << "\t}\n";
+		}
+		for (uint32_t index = 0; index < m_systems.size(); index++)
+		{
+			for (const uint32_t dependency : m_systems[index].dependencies)
+			{
+				graph << "\tsystem" << dependency << " -> system" << index << ";\n";
+			}
+		}
+		graph << "}\n";
+		return graph.str();
+	}
+
+	void Core::SystemScheduler::DumpGraph(const Path& path)
+	{
+		if (Utils::FileSystem::WriteFileAtomic(path, GetGraph()))
+			PrintLog("System schedule written to %s", path.generic_string().c_str());
+		else
+			PrintError("Failed to write the system schedule to %s", path.generic_string().c_str());
+	}
+}
@@ -17,23 +17,19 @@ void Core::ThreadManager::ThreadLoop()
 {
 	while (!m_terminate)
 	{
-		std::this_thread::sleep_for(std::chrono::milliseconds(1));
-		if (!m_tasks.empty())
+		std::function<void()> task;
 		{
-			Lock();
-			if (!m_tasks.empty()) {
-				const std::function<void()> task = m_tasks.front();
-				m_tasks.pop();
-				Unlock();
-				if (task != nullptr)
-					task();
-				break;
-			}
-			Unlock();
+			std::unique_lock lock(m_mutex);
+			// Woken up by AddTask, the timeout keeps checking for the termination
+			m_taskCondition.wait_for(lock, std::chrono::milliseconds(1), [this] { return !m_tasks.empty() || m_terminate; });
+			if (m_tasks.empty())
+				continue;
+			task = m_tasks.front();
+			m_tasks.pop();
 		}
+		if (task != nullptr)
+			task();
 	}
-	if (!m_terminate)
-		ThreadLoop();
 }
 
 void Core::ThreadManager::Lock()
@@ -0,0 +1,58 @@
+#include "pch.h"
+#include "Core/TickRegistry.h"
+
+namespace GALAXY
+{
+	Core::TickRegistry::~TickRegistry()
+	{
+		// Components outliving the scene keep no pointer to it
+		for (uint32_t group = 0; group < Component::tickGroupCount; group++)
+		{
+			for (Component::BaseComponent* component : m_groups[group].components)
+			{
+				if (!component)
+					continue;
+				component->p_tick.registry = nullptr;
+				component->p_tick.indices[group] = INDEX_NONE;
+			}
+		}
+	}
+
+	void Core::TickRegistry::Register(Component::BaseComponent* component, const uint32_t group)
+	{
+		Group& tickGroup = m_groups[group];
+		component->p_tick.indices[group] = static_cast<uint32_t>(tickGroup.components.size());
+		tickGroup.components.push_back(component);
+	}
+
+	void Core::TickRegistry::Unregister(Component::BaseComponent* component, const uint32_t group)
+	{
+		Group& tickGroup = m_groups[group];
+		const uint32_t index = component->p_tick.indices[group];
+		component->p_tick.indices[group] = INDEX_NONE;
+
+		// The list is iterated, keep the other entries in place until the iteration ends
+		if (tickGroup.iterating != 0)
+		{
+			tickGroup.components[index] = nullptr;
+			tickGroup.holes++;
+			return;
+		}
+
+		Component::BaseComponent* last = tickGroup.components.back();
+		tickGroup.components[index] = last;
+		last->p_tick.indices[group] = index;
+		tickGroup.components.pop_back();
+	}
+
+	void Core::TickRegistry::Compact(const uint32_t group)
+	{
+		Group& tickGroup = m_groups[group];
+		std::erase(tickGroup.components, nullptr);
+		for (uint32_t i = 0; i < tickGroup.components.size(); i++)
+		{
+			tickGroup.components[i]->p_tick.indices[group] = i;
+		}
+		tickGroup.holes = 0;
+	}
+}
@@ -0,0 +1,272 @@
+#include "pch.h"
+#include "Core/TransformHierarchy.h"
+#include "Core/GameObject.h"
+#include "Core/ThreadManager.h"
+
+#include "Component/Transform.h"
+
+#include "Utils/AffineMath.h"
+
+#include <bit>
+
+namespace GALAXY
+{
+	Core::TransformHierarchy::~TransformHierarchy()
+	{
+		Clear();
+	}
+
+	void Core::TransformHierarchy::Update(GameObject* root)
+	{
+		if (!root)
+			return;
+		if (m_structureDirty)
+			Rebuild(root);
+
+		if (m_hasUpdated)
+		{
+			std::ranges::fill(m_updated, 0);
+			m_hasUpdated = false;
+		}
+		if (m_firstDirty == noParent)
+			return;
+
+		m_version++;
+		const uint32_t size = static_cast<uint32_t>(m_transforms.size());
+		if (size - m_firstDirty < m_parallelThreshold)
+			UpdateRange(m_firstDirty, size);
+		else
+			UpdateLevels();
+
+		std::ranges::fill(m_dirty, 0);
+		m_firstDirty = noParent;
+		m_hasUpdated = true;
+	}
+
+	void Core::TransformHierarchy::InvokeUpdateEvents() const
+	{
+		if (!m_hasUpdated)
+			return;
+		// An event can destroy objects, their transforms are removed from the arrays without moving the others
+		for (size_t word = 0; word < m_updated.size(); word++)
+		{
+			for (uint64_t bits = m_updated[word]; bits != 0; bits &= bits - 1)
+			{
+				if (Component::Transform* transform = m_transforms[word * 64 + std::countr_zero(bits)])
+					transform->EOnUpdate.Invoke();
+			}
+		}
+	}
+
+	void Core::TransformHierarchy::UpdateRange(const uint32_t begin, const uint32_t end)
+	{
+		// Walk the range by word of the dirty bits, the local matrices of a word are composed together
+		uint32_t wordBegin = begin;
+		while (wordBegin < end)
+		{
+			const uint32_t wordEnd = std::min(end, (wordBegin / 64 + 1) * 64);
+			ComposeDirty(wordBegin, wordEnd);
+
+			// Parents are before their children, so their updated bit is final when their children are reached
+			for (uint32_t i = wordBegin; i < wordEnd; i++)
+			{
+				if (!GetBit(m_dirty, i) && !IsParentUpdated(i))
+					continue;
+
+				const uint32_t parent = m_parents[i];
+				if (parent == noParent)
+					m_worldMatrices[i] = m_localMatrices[i];
+				else
+					Utils::AffineMath::Multiply(m_worldMatrices[parent], m_localMatrices[i], m_worldMatrices[i]);
+				m_versions[i] = m_version;
+				SetUpdated(i);
+			}
+			wordBegin = wordEnd;
+		}
+	}
+
+	void Core::TransformHierarchy::ComposeDirty(const uint32_t begin, const uint32_t end)
+	{
+		const uint32_t firstBit = begin % 64;
+		const uint32_t bitCount = end - begin;
+		uint64_t bits = m_dirty[begin / 64] >> firstBit;
+		if (bitCount < 64)
+			bits &= (uint64_t(1) << bitCount) - 1;
+		if (bits == 0)
+			return;
+
+		Utils::AffineMath::TRSBlock block;
+		uint32_t indices[Utils::AffineMath::TRSBlock::capacity];
+		size_t count = 0;
+		for (; bits != 0; bits &= bits - 1)
+		{
+			const uint32_t index = begin + std::countr_zero(bits);
+			const Component::Transform* transform = m_transforms[index];
+			if (!transform)
+				continue;
+			block.Set(count, transform->m_localPosition, transform->m_localRotation, transform->m_localScale);
+			indices[count++] = index;
+		}
+
+		Mat4 matrices[Utils::AffineMath::TRSBlock::capacity];
+		Utils::AffineMath::ComposeTRS(block, count, matrices);
+		for (size_t i = 0; i < count; i++)
+		{
+			m_localMatrices[indices[i]] = matrices[i];
+		}
+	}
+
+	void Core::TransformHierarchy::UpdateLevels()
+	{
+		// Multiple of 64 so two chunks never write the same word of the updated bits
+		constexpr uint32_t chunkSize = 1024;
+
+		// The transforms of a level only read the previous levels, each level is finished before the next one starts.
+		// Every matrix is computed from the same values whatever the thread, so the result does not depend on the split
+		ThreadManager* threadManager = ThreadManager::GetInstance();
+		for (size_t level = 0; level + 1 < m_levelOffsets.size(); level++)
+		{
+			const uint32_t begin = std::max(m_levelOffsets[level], m_firstDirty);
+			const uint32_t end = m_levelOffsets[level + 1];
+			if (begin >= end)
+				continue;
+			if (end - begin < chunkSize * 2)
+			{
+				UpdateRange(begin, end);
+				continue;
+			}
+
+			const uint32_t firstChunk = begin / chunkSize;
+			const uint32_t chunkCount = (end - 1) / chunkSize - firstChunk + 1;
+			threadManager->ParallelFor(chunkCount, [&](const size_t chunk)
+				{
+					const uint32_t chunkBegin = static_cast<uint32_t>((firstChunk + chunk) * chunkSize);
+					UpdateRange(std::max(chunkBegin, begin), std::min(chunkBegin + chunkSize, end));
+				});
+		}
+	}
+
+	void Core::TransformHierarchy::Remove(const uint32_t index)
+	{
+		m_transforms[index] = nullptr;
+		m_structureDirty = true;
+	}
+
+	void Core::TransformHierarchy::Rebuild(GameObject* root)
+	{
+		// The previous arrays tell which transforms keep their parent and their matrices
+		const List<Component::Transform*> previousTransforms = std::move(m_transforms);
+		const List<uint32_t> previousParents = std::move(m_parents);
+		const List<Mat4> previousLocalMatrices = std::move(m_localMatrices);
+		const List<Mat4> previousWorldMatrices = std::move(m_worldMatrices);
+		const List<uint32_t> previousVersions = std::move(m_versions);
+		const List<uint64_t> previousDirty = std::move(m_dirty);
+		m_transforms.clear();
+		m_parents.clear();
+		m_localMatrices.clear();
+		m_worldMatrices.clear();
+		m_versions.clear();
+		m_levelOffsets.clear();
+		m_firstDirty = noParent;
+		m_hasUpdated = false;
+
+		// Walk the objects level by level
+		List<GameObject*> objects = { root };
+		m_parents.push_back(noParent);
+		size_t levelBegin = 0;
+		while (levelBegin < objects.size())
+		{
+			const size_t levelEnd = objects.size();
+			m_levelOffsets.push_back(static_cast<uint32_t>(levelBegin));
+			for (size_t i = levelBegin; i < levelEnd; i++)
+			{
+				for (const Shared<GameObject>& child : objects[i]->m_children)
+				{
+					objects.push_back(child.get());
+					m_parents.push_back(static_cast<uint32_t>(i));
+				}
+			}
+			levelBegin = levelEnd;
+		}
+		m_levelOffsets.push_back(static_cast<uint32_t>(objects.size()));
+
+		const size_t size = objects.size();
+		m_transforms.resize(size);
+		m_localMatrices.resize(size);
+		m_worldMatrices.resize(size);
+		m_versions.assign(size, 0);
+		m_dirty.assign((size + 63) / 64, 0);
+		m_updated.assign((size + 63) / 64, 0);
+		// Index of each transform in the previous arrays, noParent for the new ones
+		List<uint32_t> previousIndices(size, noParent);
+		List<bool> kept(previousTransforms.size(), false);
+		for (uint32_t i = 0; i < size; i++)
+		{
+			Component::Transform* transform = objects[i]->GetTransform();
+			const uint32_t registeredIndex = transform->m_hierarchyIndex;
+			if (transform->m_hierarchy == this && registeredIndex < previousTransforms.size() && previousTransforms[registeredIndex] == transform)
+			{
+				previousIndices[i] = registeredIndex;
+				kept[registeredIndex] = true;
+			}
+			transform->m_hierarchy = this;
+			transform->m_hierarchyIndex = i;
+			m_transforms[i] = transform;
+
+			// A transform with the same parent keeps its matrices and its dirty state, the others are computed again
+			const uint32_t previousIndex = previousIndices[i];
+			const uint32_t parent = m_parents[i];
+			const uint32_t previousParent = parent == noParent ? noParent : previousIndices[parent];
+			if (previousIndex != noParent && previousParents[previousIndex] == previousParent
+				&& (parent == noParent || previousParent != noParent) && !GetBit(previousDirty, previousIndex))
+			{
+				m_localMatrices[i] = previousLocalMatrices[previousIndex];
+				m_worldMatrices[i] = previousWorldMatrices[previousIndex];
+				m_versions[i] = previousVersions[previousIndex];
+			}
+			else
+			{
+				transform->m_worldCache.version = -1;
+				SetDirty(i);
+			}
+		}
+
+		// The transforms that left the scene keep their last world matrix
+		for (size_t i = 0; i < previousTransforms.size(); i++)
+		{
+			Component::Transform* transform = previousTransforms[i];
+			if (!transform || kept[i])
+				continue;
+			transform->m_hierarchy = nullptr;
+			transform->m_modelMatrix = previousWorldMatrices[i];
+			transform->m_worldCache.version = -1;
+			transform->m_dirty = true;
+		}
+		m_structureDirty = false;
+	}
+
+	void Core::TransformHierarchy::Clear()
+	{
+		for (size_t i = 0; i < m_transforms.size(); i++)
+		{
+			if (Component::Transform* transform = m_transforms[i])
+			{
+				transform->m_hierarchy = nullptr;
+				transform->m_modelMatrix = m_worldMatrices[i];
+				transform->m_worldCache.version = -1;
+				transform->m_dirty = true;
+			}
+		}
+		m_transforms.clear();
+		m_parents.clear();
+		m_localMatrices.clear();
+		m_worldMatrices.clear();
+		m_versions.clear();
+		m_levelOffsets.clear();
+		m_dirty.clear();
+		m_updated.clear();
+		m_firstDirty = noParent;
+		m_hasUpdated = false;
+		m_structureDirty = true;
+	}
+}
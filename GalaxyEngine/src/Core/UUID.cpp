@@ -2,15 +2,27 @@
 
 #include "Core/UUID.h"
 
+#include <mutex>
 #include <random>
 
 namespace GALAXY
 {
-	static std::random_device s_RandomDevice;
-	static std::mt19937_64 s_Engine(s_RandomDevice());
-	static std::uniform_int_distribution<uint64_t> s_UniformDistribution;
+	// Objects are created on the worker threads too, each thread draws from its own engine.
+	// Only the seeding reads the shared random device
+	static std::mt19937_64& GetEngine()
+	{
+		static std::random_device s_RandomDevice;
+		static std::mutex s_RandomDeviceMutex;
+		thread_local std::mt19937_64 s_Engine = []
+			{
+				std::scoped_lock lock(s_RandomDeviceMutex);
+				std::seed_seq seed{ s_RandomDevice(), s_RandomDevice(), s_RandomDevice(), s_RandomDevice() };
+				return std::mt19937_64(seed);
+			}();
+		return s_Engine;
+	}
 
-	Core::UUID::UUID() : m_UUID(s_UniformDistribution(s_Engine))
+	Core::UUID::UUID() : m_UUID(std::uniform_int_distribution<uint64_t>()(GetEngine()))
 	{
 		
 	}
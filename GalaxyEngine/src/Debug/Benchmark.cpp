@@ -0,0 +1,388 @@
+#include "pch.h"
+#include "Debug/Benchmark.h"
+
+#include "Core/GameObject.h"
+#include "Core/TransformHierarchy.h"
+
+#include "Utils/AffineMath.h"
+#include "Utils/Simd.h"
+
+#include "Physic/FrustumCulling.h"
+#include "Physic/DynamicBVH.h"
+
+#include "Render/OcclusionBuffer.h"
+
+#include <random>
+
+namespace GALAXY
+{
+	// Return the average duration of func in milliseconds
+	template<typename F>
+	static double Measure(const size_t iterations, F&& func)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < iterations; i++)
+		{
+			func();
+		}
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / static_cast<double>(iterations);
+	}
+
+	static void PrintResult(const char* name, const double scalarTime, const double kernelTime)
+	{
+		PrintLog("%s : scalar %.3f ms, %s %.3f ms (x%.2f)", name, scalarTime, Utils::Simd::GetInstructionSet(), kernelTime, scalarTime / kernelTime);
+	}
+
+	void Debug::Benchmark::RunTransformBenchmarks(const size_t transformCount)
+	{
+		constexpr size_t iterations = 10;
+		constexpr size_t blockSize = Utils::AffineMath::TRSBlock::capacity;
+
+		std::mt19937 generator(0);
+		std::uniform_real_distribution distribution(-10.f, 10.f);
+		List<Vec3f> positions(transformCount);
+		List<Quat> rotations(transformCount);
+		List<Vec3f> scales(transformCount);
+		for (size_t i = 0; i < transformCount; i++)
+		{
+			positions[i] = Vec3f(distribution(generator), distribution(generator), distribution(generator));
+			rotations[i] = Vec3f(distribution(generator), distribution(generator), distribution(generator)).ToQuaternion();
+			scales[i] = Vec3f(1.f + std::abs(distribution(generator)));
+		}
+
+		// Every result is summed so the compiler cannot remove the loops
+		float checksum = 0.f;
+		List<Mat4> locals(transformCount);
+		List<Mat4> results(transformCount);
+
+		// TRS composition
+		{
+			const double scalarTime = Measure(iterations, [&]()
+				{
+					for (size_t i = 0; i < transformCount; i++)
+						locals[i] = Mat4::CreateTransformMatrix(positions[i], rotations[i], scales[i]);
+				});
+			Utils::AffineMath::TRSBlock block;
+			const double kernelTime = Measure(iterations, [&]()
+				{
+					for (size_t begin = 0; begin < transformCount; begin += blockSize)
+					{
+						const size_t count = std::min(blockSize, transformCount - begin);
+						for (size_t i = 0; i < count; i++)
+							block.Set(i, positions[begin + i], rotations[begin + i], scales[begin + i]);
+						Utils::AffineMath::ComposeTRS(block, count, locals.data() + begin);
+					}
+				});
+			checksum += locals.back().Data()[0];
+			PrintResult("Compose TRS", scalarTime, kernelTime);
+		}
+
+		// Parent * local, each transform uses the previous local matrix as parent
+		{
+			const double scalarTime = Measure(iterations, [&]()
+				{
+					results[0] = locals[0];
+					for (size_t i = 1; i < transformCount; i++)
+						results[i] = locals[i - 1] * locals[i];
+				});
+			checksum += results.back().Data()[0];
+			const double kernelTime = Measure(iterations, [&]()
+				{
+					results[0] = locals[0];
+					for (size_t i = 1; i < transformCount; i++)
+						Utils::AffineMath::Multiply(locals[i - 1], locals[i], results[i]);
+				});
+			checksum += results.back().Data()[0];
+			PrintResult("Multiply", scalarTime, kernelTime);
+		}
+
+		// Normal matrices
+		{
+			const double scalarTime = Measure(iterations, [&]()
+				{
+					for (size_t i = 0; i < transformCount; i++)
+					{
+						const Mat4 inverse = locals[i].CreateInverseMatrix();
+						for (int column = 0; column < 4; column++)
+						{
+							for (int row = 0; row < 4; row++)
+								results[i].Data()[column * 4 + row] = inverse.Data()[row * 4 + column];
+						}
+					}
+				});
+			checksum += results.back().Data()[0];
+			const double kernelTime = Measure(iterations, [&]()
+				{
+					for (size_t i = 0; i < transformCount; i++)
+						Utils::AffineMath::ComputeNormalMatrix(locals[i], results[i]);
+				});
+			checksum += results.back().Data()[0];
+			PrintResult("Normal matrix", scalarTime, kernelTime);
+		}
+
+		// Moving the root of the whole tree, objects grouped under square root of the count parents
+		{
+			const Shared<Core::GameObject> root = Core::GameObject::Create("Benchmark");
+			const size_t groupCount = std::max<size_t>(1, static_cast<size_t>(std::sqrt(static_cast<double>(transformCount))));
+			List<Shared<Core::GameObject>> groups(groupCount);
+			for (Shared<Core::GameObject>& group : groups)
+			{
+				group = Core::GameObject::Create();
+				root->AddChild(group);
+			}
+			for (size_t i = 0; i < transformCount; i++)
+			{
+				const Shared<Core::GameObject> object = Core::GameObject::Create();
+				object->GetTransform()->SetLocalPosition(positions[i]);
+				object->GetTransform()->SetLocalRotation(rotations[i]);
+				object->GetTransform()->SetLocalScale(scales[i]);
+				groups[i % groupCount]->AddChild(object);
+			}
+
+			Component::Transform* rootTransform = root->GetTransform();
+			float offset = 0.f;
+			const double recursiveTime = Measure(iterations, [&]()
+				{
+					rootTransform->SetLocalPosition(Vec3f(offset += 1.f));
+					rootTransform->ForceUpdate();
+				});
+
+			// Declared after the objects so the transforms are unregistered before being destroyed
+			Core::TransformHierarchy hierarchy;
+			hierarchy.SetParallelThreshold(SIZE_MAX);
+			hierarchy.Update(root.get());
+			const double serialTime = Measure(iterations, [&]()
+				{
+					rootTransform->SetLocalPosition(Vec3f(offset += 1.f));
+					hierarchy.Update(root.get());
+				});
+			hierarchy.SetParallelThreshold(0);
+			const double parallelTime = Measure(iterations, [&]()
+				{
+					rootTransform->SetLocalPosition(Vec3f(offset += 1.f));
+					hierarchy.Update(root.get());
+				});
+			checksum += groups.back()->GetChildren().back().lock()->GetTransform()->GetModelMatrix().Data()[12];
+
+			PrintLog("Move root of %zu transforms : recursive %.3f ms, hierarchy %.3f ms, parallel hierarchy %.3f ms",
+				transformCount, recursiveTime, serialTime, parallelTime);
+		}
+		PrintLog("Transform benchmarks checksum %f", checksum);
+	}
+
+	void Debug::Benchmark::RunCullingBenchmarks(const size_t boxCount)
+	{
+		constexpr size_t iterations = 10;
+
+		std::mt19937 generator(0);
+		std::uniform_real_distribution position(-1000.f, 1000.f);
+		std::uniform_real_distribution size(0.5f, 10.f);
+		List<Physic::AABB> boxes(boxCount);
+		Physic::AABBArray array;
+		for (Physic::AABB& box : boxes)
+		{
+			const Vec3f center(position(generator), position(generator), position(generator));
+			const Vec3f extents(size(generator), size(generator), size(generator));
+			box = Physic::AABB(center - extents, center + extents);
+			array.Add(box);
+		}
+
+		// Cameras at the origin looking along an axis with a 90 degrees field of view, about a sixth of the boxes are visible by each
+		auto createFrustum = [](const Vec3f& forward, const Vec3f& right, const Vec3f& up)
+			{
+				Physic::Frustum frustum;
+				frustum.planes[0] = Physic::Plane(forward * 0.1f, forward);
+				frustum.planes[1] = Physic::Plane(forward * 1000.f, -forward);
+				frustum.planes[2] = Physic::Plane(Vec3f::Zero(), right + forward);
+				frustum.planes[3] = Physic::Plane(Vec3f::Zero(), -right + forward);
+				frustum.planes[4] = Physic::Plane(Vec3f::Zero(), up + forward);
+				frustum.planes[5] = Physic::Plane(Vec3f::Zero(), -up + forward);
+				return frustum;
+			};
+		const Physic::Frustum frustum = createFrustum(Vec3f(0.f, 0.f, 1.f), Vec3f(1.f, 0.f, 0.f), Vec3f(0.f, 1.f, 0.f));
+
+		List<uint32_t> visible;
+		visible.reserve(boxCount);
+		const double scalarTime = Measure(iterations, [&]()
+			{
+				visible.clear();
+				for (uint32_t i = 0; i < boxCount; i++)
+				{
+					if (boxes[i].IntersectsFrustum(frustum))
+						visible.push_back(i);
+				}
+			});
+		const size_t scalarCount = visible.size();
+
+		const double kernelTime = Measure(iterations, [&]()
+			{
+				visible.resize(boxCount);
+				visible.resize(Physic::FrustumCulling::CullRange(frustum, array, 0, static_cast<uint32_t>(boxCount), visible.data()));
+			});
+		const size_t kernelCount = visible.size();
+
+		const double parallelTime = Measure(iterations, [&]()
+			{
+				Physic::FrustumCulling::Cull(frustum, array, visible);
+			});
+
+		// Same boxes in a tree, the rejecting planes are cached between the iterations like between frames
+		Physic::DynamicBVH tree;
+		for (uint32_t i = 0; i < boxCount; i++)
+		{
+			tree.CreateProxy(boxes[i], {});
+		}
+		tree.Rebuild();
+		Physic::FrustumCullCache cache;
+		List<uint32_t> proxies;
+		proxies.reserve(boxCount);
+		const double hierarchicalTime = Measure(iterations, [&]()
+			{
+				proxies.clear();
+				tree.CullFrustum(frustum, proxies, &cache);
+			});
+
+		// Four cameras culled one after the other and in a single pass
+		constexpr uint32_t viewCount = 4;
+		const Physic::Frustum views[viewCount] = {
+			frustum,
+			createFrustum(Vec3f(0.f, 0.f, -1.f), Vec3f(1.f, 0.f, 0.f), Vec3f(0.f, 1.f, 0.f)),
+			createFrustum(Vec3f(1.f, 0.f, 0.f), Vec3f(0.f, 0.f, 1.f), Vec3f(0.f, 1.f, 0.f)),
+			createFrustum(Vec3f(-1.f, 0.f, 0.f), Vec3f(0.f, 0.f, 1.f), Vec3f(0.f, 1.f, 0.f)) };
+		List<uint32_t> viewVisible[viewCount];
+		const double separateViewsTime = Measure(iterations, [&]()
+			{
+				for (uint32_t view = 0; view < viewCount; view++)
+				{
+					Physic::FrustumCulling::Cull(views[view], array, viewVisible[view]);
+				}
+			});
+		const double singlePassTime = Measure(iterations, [&]()
+			{
+				Physic::FrustumCulling::CullViews(views, viewCount, array, viewVisible);
+			});
+		const double separateTreeTime = Measure(iterations, [&]()
+			{
+				for (uint32_t view = 0; view < viewCount; view++)
+				{
+					viewVisible[view].clear();
+					tree.CullFrustum(views[view], viewVisible[view]);
+				}
+			});
+		const double singleTraversalTime = Measure(iterations, [&]()
+			{
+				for (List<uint32_t>& proxyList : viewVisible)
+				{
+					proxyList.clear();
+				}
+				tree.CullFrustums(views, viewCount, viewVisible);
+			});
+
+		PrintLog("Cull %zu boxes : scalar %.3f ms, %s %.3f ms (x%.2f), parallel %s %.3f ms (x%.2f)", boxCount,
+			scalarTime, Utils::Simd::GetInstructionSet(), kernelTime, scalarTime / kernelTime,
+			Utils::Simd::GetInstructionSet(), parallelTime, scalarTime / parallelTime);
+		PrintLog("Cull %zu boxes in a tree : %.3f ms (x%.2f)", boxCount, hierarchicalTime, scalarTime / hierarchicalTime);
+		PrintLog("Visible boxes : scalar %zu, %s %zu, parallel %zu, tree %zu", scalarCount, Utils::Simd::GetInstructionSet(), kernelCount, visible.size(), proxies.size());
+		PrintLog("Cull %zu boxes for %u cameras : separate %.3f ms, single pass %.3f ms (x%.2f), separate trees %.3f ms, single traversal %.3f ms (x%.2f)",
+			boxCount, viewCount, separateViewsTime, singlePassTime, separateViewsTime / singlePassTime,
+			separateTreeTime, singleTraversalTime, separateTreeTime / singleTraversalTime);
+	}
+
+	void Debug::Benchmark::RunHierarchyBenchmarks(const size_t childCount)
+	{
+		// Removing the children of one parent one by one must stay linear in their number
+		constexpr double maxTime = 10.0;
+
+		std::mt19937 generator(0);
+		const Shared<Core::GameObject> parent = Core::GameObject::Create("Benchmark");
+		const Shared<Core::GameObject> otherParent = Core::GameObject::Create("Benchmark");
+		List<Shared<Core::GameObject>> children(childCount);
+		auto addChildren = [&]()
+			{
+				for (Shared<Core::GameObject>& child : children)
+				{
+					child = Core::GameObject::Create();
+					parent->AddChild(child);
+				}
+				std::ranges::shuffle(children, generator);
+			};
+
+		addChildren();
+		const double removeTime = Measure(1, [&]()
+			{
+				for (const Shared<Core::GameObject>& child : children)
+				{
+					child->RemoveFromParent();
+				}
+			});
+		if (!parent->GetChildren().empty())
+			PrintError("Hierarchy benchmark : %zu children left after their removal", parent->GetChildren().size());
+
+		addChildren();
+		const double moveTime = Measure(1, [&]()
+			{
+				for (const Shared<Core::GameObject>& child : children)
+				{
+					child->SetParent(otherParent);
+				}
+			});
+		if (!parent->GetChildren().empty() || otherParent->GetChildren().size() != childCount)
+			PrintError("Hierarchy benchmark : the children were not all moved");
+
+		PrintLog("Remove %zu siblings one by one : %.3f ms, move them to another parent : %.3f ms", childCount, removeTime, moveTime);
+		if (removeTime > maxTime || moveTime > maxTime)
+			PrintWarning("Hierarchy benchmark : removing %zu siblings took more than %.0f ms", childCount, maxTime);
+	}
+
+	void Debug::Benchmark::RunOcclusionBenchmarks(const size_t boxCount)
+	{
+		constexpr size_t iterations = 10;
+		constexpr int wallCount = 16;
+
+		// Camera at the origin looking down -Z, a row of walls facing it hides the boxes behind them
+		const Mat4 viewProjection = Mat4::CreateProjectionMatrix(90.f, 2.f, 0.1f, 1000.f);
+		List<Vec3f> walls;
+		for (int i = 0; i < wallCount; i++)
+		{
+			const float left = -80.f + 10.f * static_cast<float>(i);
+			const float right = left + 9.f;
+			const float depth = -20.f - static_cast<float>(i % 4);
+			const Vec3f corners[4] = { Vec3f(left, -20.f, depth), Vec3f(right, -20.f, depth), Vec3f(right, 20.f, depth), Vec3f(left, 20.f, depth) };
+			walls.insert(walls.end(), { corners[0], corners[1], corners[2], corners[0], corners[2], corners[3] });
+		}
+
+		std::mt19937 generator(0);
+		std::uniform_real_distribution side(-100.f, 100.f);
+		std::uniform_real_distribution distance(-200.f, -1.f);
+		std::uniform_real_distribution size(0.1f, 2.f);
+		List<Physic::AABB> boxes(boxCount);
+		for (Physic::AABB& box : boxes)
+		{
+			const Vec3f center(side(generator), side(generator) * 0.5f, distance(generator));
+			const Vec3f extents(size(generator), size(generator), size(generator));
+			box = Physic::AABB(center - extents, center + extents);
+		}
+
+		Render::OcclusionBuffer buffer;
+		const double rasterTime = Measure(iterations, [&]()
+			{
+				buffer.Begin(viewProjection);
+				buffer.AddOccluder(walls.data(), walls.size(), Mat4::Identity());
+				buffer.End();
+			});
+
+		size_t visibleCount = 0;
+		const double testTime = Measure(iterations, [&]()
+			{
+				visibleCount = 0;
+				for (const Physic::AABB& box : boxes)
+				{
+					visibleCount += buffer.IsVisible(box);
+				}
+			});
+
+		PrintLog("Rasterize %zu triangles in a %ux%u occlusion buffer : %s %.3f ms", buffer.GetTriangleCount(),
+			buffer.GetWidth(), buffer.GetHeight(), Utils::Simd::GetInstructionSet(), rasterTime);
+		PrintLog("Test %zu boxes against the occlusion buffer : %.3f ms, %zu hidden", boxCount, testTime, boxCount - visibleCount);
+	}
+}
@@ -0,0 +1,325 @@
+#include "pch.h"
+#include "Debug/SelfTest.h"
+
+#include "Physic/DynamicBVH.h"
+
+#include "Utils/AffineMath.h"
+#include "Utils/Simd.h"
+
+#include <random>
+
+namespace GALAXY
+{
+	using ObjectHandle = Physic::DynamicBVH::ObjectHandle;
+
+	// Return true if both lists hold the same objects, in any order
+	static bool SameObjects(List<ObjectHandle> a, List<ObjectHandle> b)
+	{
+		auto less = [](const ObjectHandle& left, const ObjectHandle& right) { return left.index < right.index; };
+		std::sort(a.begin(), a.end(), less);
+		std::sort(b.begin(), b.end(), less);
+		return a == b;
+	}
+
+	bool Debug::SelfTest::RunSpatialIndexTest(const uint32_t seed, const size_t stepCount)
+	{
+		constexpr size_t initialCount = 2000;
+		constexpr size_t queryCount = 8;
+		constexpr float worldSize = 100.f;
+
+		std::mt19937 generator(seed);
+		std::uniform_real_distribution position(-worldSize, worldSize);
+		std::uniform_real_distribution unit(-1.f, 1.f);
+		std::uniform_real_distribution size(0.1f, 5.f);
+		auto randomBox = [&]()
+			{
+				const Vec3f center(position(generator), position(generator), position(generator));
+				const Vec3f extents(size(generator), size(generator), size(generator));
+				return Physic::AABB(center - extents, center + extents);
+			};
+		auto randomDirection = [&]()
+			{
+				Vec3f direction;
+				do
+				{
+					direction = Vec3f(unit(generator), unit(generator), unit(generator));
+				} while (direction.Length() < 0.1f);
+				return direction.GetNormalize();
+			};
+
+		// Every live proxy with its object and box, the reference the queries are compared with
+		struct Entry
+		{
+			uint32_t proxy;
+			ObjectHandle object;
+			Physic::AABB bounds;
+		};
+		List<Entry> entries;
+		uint32_t nextObject = 0;
+
+		Physic::DynamicBVH bvh;
+		bvh.SetBackgroundRebuild(true);
+		// Rebuilt as soon as the tree gets worse, so the churn keeps a rebuild running most of the time
+		bvh.SetRebuildThreshold(1.05f);
+
+		auto create = [&]()
+			{
+				const ObjectHandle object = { nextObject++, 0 };
+				const Physic::AABB bounds = randomBox();
+				entries.push_back({ bvh.CreateProxy(bounds, object), object, bounds });
+			};
+		for (size_t i = 0; i < initialCount; i++)
+		{
+			create();
+		}
+
+		size_t mismatchCount = 0;
+		size_t stepsWhileRebuilding = 0;
+		auto check = [&](const char* query, const size_t step, const bool same)
+			{
+				if (same)
+					return;
+				if (mismatchCount++ < 10)
+					PrintError("Spatial index test : %s differs from the test of every box at step %zu (seed %u)", query, step, seed);
+			};
+
+		auto runQueries = [&](const size_t step)
+			{
+				List<ObjectHandle> expected;
+				List<ObjectHandle> result;
+				for (size_t query = 0; query < queryCount; query++)
+				{
+					// Frustum of a random camera looking at the scene
+					const Vec3f eye(position(generator), position(generator), position(generator));
+					const Vec3f forward = randomDirection();
+					const Vec3f right = forward.Cross(randomDirection()).GetNormalize();
+					const Vec3f up = right.Cross(forward);
+					Physic::Frustum frustum;
+					frustum.planes[0] = Physic::Plane(eye + forward * 0.1f, forward);
+					frustum.planes[1] = Physic::Plane(eye + forward * worldSize, -forward);
+					frustum.planes[2] = Physic::Plane(eye, right + forward);
+					frustum.planes[3] = Physic::Plane(eye, -right + forward);
+					frustum.planes[4] = Physic::Plane(eye, up + forward);
+					frustum.planes[5] = Physic::Plane(eye, -up + forward);
+
+					expected.clear();
+					for (const Entry& entry : entries)
+					{
+						if (entry.bounds.IntersectsFrustum(frustum))
+							expected.push_back(entry.object);
+					}
+					result.clear();
+					bvh.QueryFrustum(frustum, result);
+					check("QueryFrustum", step, SameObjects(expected, result));
+
+					const Physic::AABB box = randomBox().Enlarge(2.f);
+					expected.clear();
+					for (const Entry& entry : entries)
+					{
+						if (entry.bounds.Intersects(box))
+							expected.push_back(entry.object);
+					}
+					result.clear();
+					bvh.QueryAABB(box, result);
+					check("QueryAABB", step, SameObjects(expected, result));
+
+					const Vec3f center(position(generator), position(generator), position(generator));
+					const float radius = size(generator) * 4.f;
+					expected.clear();
+					for (const Entry& entry : entries)
+					{
+						if (entry.bounds.IntersectsSphere(center, radius))
+							expected.push_back(entry.object);
+					}
+					result.clear();
+					bvh.QuerySphere(center, radius, result);
+					check("QuerySphere", step, SameObjects(expected, result));
+
+					const Physic::Ray ray = { eye, forward, worldSize * 2.f };
+					expected.clear();
+					float closestDistance = FLT_MAX;
+					for (const Entry& entry : entries)
+					{
+						float distance;
+						if (!entry.bounds.IntersectsRay(ray, distance))
+							continue;
+						expected.push_back(entry.object);
+						closestDistance = std::min(closestDistance, distance);
+					}
+					result.clear();
+					bvh.QueryRay(ray, result);
+					check("QueryRay", step, SameObjects(expected, result));
+
+					// Several boxes can be entered at the same distance, only the distance is compared
+					float distance = FLT_MAX;
+					const ObjectHandle closest = bvh.RaycastClosest(ray, &distance);
+					const bool hit = closest.index != INDEX_NONE;
+					check("RaycastClosest", step, hit == !expected.empty() && (!hit || std::abs(distance - closestDistance) <= 1e-4f * (1.f + closestDistance)));
+				}
+			};
+
+		for (size_t step = 0; step < stepCount; step++)
+		{
+			// Churn : new and destroyed objects, small moves inside the margin of the leaves and teleports
+			std::uniform_int_distribution<size_t> pick(0, entries.size() - 1);
+			for (int i = 0; i < 20; i++)
+			{
+				create();
+			}
+			for (int i = 0; i < 20 && !entries.empty(); i++)
+			{
+				const size_t index = std::uniform_int_distribution<size_t>(0, entries.size() - 1)(generator);
+				bvh.DestroyProxy(entries[index].proxy);
+				entries[index] = entries.back();
+				entries.pop_back();
+			}
+			for (int i = 0; i < 100; i++)
+			{
+				Entry& entry = entries[pick(generator) % entries.size()];
+				if (i % 4 == 0)
+				{
+					entry.bounds = randomBox();
+				}
+				else
+				{
+					const Vec3f offset = Vec3f(unit(generator), unit(generator), unit(generator)) * 0.05f;
+					entry.bounds = Physic::AABB(entry.bounds.min + offset, entry.bounds.max + offset);
+				}
+				bvh.MoveProxy(entry.proxy, entry.bounds);
+			}
+
+			// Applies the finished rebuild and starts the next one, the changes above were made while it was running
+			bvh.Update();
+			if (bvh.IsRebuilding())
+				stepsWhileRebuilding++;
+			runQueries(step);
+		}
+
+		// Wait for the last rebuild and check the tree it gives
+		while (bvh.IsRebuilding())
+		{
+			std::this_thread::yield();
+			bvh.Update();
+		}
+		runQueries(stepCount);
+
+		if (stepsWhileRebuilding == 0)
+			PrintWarning("Spatial index test : no background rebuild ran, the rebuilds were made on the calling thread");
+		if (mismatchCount > 0)
+		{
+			PrintError("Spatial index test failed : %zu mismatches, %u rebuilds", mismatchCount, bvh.GetRebuildCount());
+			return false;
+		}
+		PrintLog("Spatial index test passed : %zu steps, %zu proxies, %u rebuilds, %zu steps during a background rebuild",
+			stepCount, bvh.GetProxyCount(), bvh.GetRebuildCount(), stepsWhileRebuilding);
+		return true;
+	}
+
+	// Largest absolute difference between the size x size upper left parts of both matrices
+	static float MaxDifference(const Mat4& a, const Mat4& b, const int size = 4)
+	{
+		float difference = 0.f;
+		for (int column = 0; column < size; column++)
+		{
+			for (int row = 0; row < size; row++)
+				difference = std::max(difference, std::abs(a.Data()[column * 4 + row] - b.Data()[column * 4 + row]));
+		}
+		return difference;
+	}
+
+	bool Debug::SelfTest::RunTransformKernelTest(const uint32_t seed, const size_t transformCount)
+	{
+		using namespace Utils::AffineMath;
+		constexpr float epsilon = 1e-3f;
+
+		std::mt19937 generator(seed);
+		std::uniform_real_distribution position(-10.f, 10.f);
+		std::uniform_real_distribution angle(-180.f, 180.f);
+		std::uniform_real_distribution scale(0.5f, 2.f);
+		// Blocks of random sizes, so the AVX, SSE and scalar lanes of ComposeTRS all run
+		std::uniform_int_distribution<size_t> blockCount(1, TRSBlock::capacity);
+
+		List<Vec3f> positions(transformCount);
+		List<Quat> rotations(transformCount);
+		List<Vec3f> scales(transformCount);
+		for (size_t i = 0; i < transformCount; i++)
+		{
+			positions[i] = Vec3f(position(generator), position(generator), position(generator));
+			rotations[i] = Vec3f(angle(generator), angle(generator), angle(generator)).ToQuaternion();
+			scales[i] = Vec3f(scale(generator), scale(generator), scale(generator));
+		}
+
+		// Largest difference with galaxymath of each kernel, the build instruction set then the scalar one
+		float composeDifference[2] = {};
+		float multiplyDifference[2] = {};
+		float normalDifference[2] = {};
+
+		List<Mat4> expected(transformCount);
+		List<Mat4> locals(transformCount);
+		List<Mat4> scalarLocals(transformCount);
+		TRSBlock block;
+		for (size_t begin = 0; begin < transformCount;)
+		{
+			const size_t count = std::min(blockCount(generator), transformCount - begin);
+			for (size_t i = 0; i < count; i++)
+				block.Set(i, positions[begin + i], rotations[begin + i], scales[begin + i]);
+			ComposeTRS(block, count, locals.data() + begin);
+			Scalar::ComposeTRS(block, count, scalarLocals.data() + begin);
+			begin += count;
+		}
+		for (size_t i = 0; i < transformCount; i++)
+		{
+			expected[i] = Mat4::CreateTransformMatrix(positions[i], rotations[i], scales[i]);
+			composeDifference[0] = std::max(composeDifference[0], MaxDifference(expected[i], locals[i]));
+			composeDifference[1] = std::max(composeDifference[1], MaxDifference(expected[i], scalarLocals[i]));
+		}
+
+		Mat4 result;
+		for (size_t i = 1; i < transformCount; i++)
+		{
+			const Mat4 product = expected[i - 1] * expected[i];
+			Multiply(expected[i - 1], expected[i], result);
+			multiplyDifference[0] = std::max(multiplyDifference[0], MaxDifference(product, result));
+			Scalar::Multiply(expected[i - 1], expected[i], result);
+			multiplyDifference[1] = std::max(multiplyDifference[1], MaxDifference(product, result));
+		}
+
+		for (size_t i = 0; i < transformCount; i++)
+		{
+			// Only the rotation and scale part is compared, the normal matrix has no translation
+			const Mat4 inverse = expected[i].CreateInverseMatrix();
+			Mat4 transpose;
+			for (int column = 0; column < 4; column++)
+			{
+				for (int row = 0; row < 4; row++)
+					transpose.Data()[column * 4 + row] = inverse.Data()[row * 4 + column];
+			}
+			ComputeNormalMatrix(expected[i], result);
+			normalDifference[0] = std::max(normalDifference[0], MaxDifference(transpose, result, 3));
+			Scalar::ComputeNormalMatrix(expected[i], result);
+			normalDifference[1] = std::max(normalDifference[1], MaxDifference(transpose, result, 3));
+		}
+
+		bool passed = true;
+		auto check = [&](const char* kernel, const float (&difference)[2])
+			{
+				const char* instructionSets[2] = { Utils::Simd::GetInstructionSet(), "Scalar" };
+				for (int i = 0; i < 2; i++)
+				{
+					if (difference[i] <= epsilon)
+						continue;
+					PrintError("Transform kernel test : %s %s differs from galaxymath by %f (seed %u)", instructionSets[i], kernel, difference[i], seed);
+					passed = false;
+				}
+			};
+		check("ComposeTRS", composeDifference);
+		check("Multiply", multiplyDifference);
+		check("ComputeNormalMatrix", normalDifference);
+		if (!passed)
+			return false;
+		PrintLog("Transform kernel test passed : %zu transforms, largest differences %s / Scalar : ComposeTRS %g / %g, Multiply %g / %g, ComputeNormalMatrix %g / %g",
+			transformCount, Utils::Simd::GetInstructionSet(), composeDifference[0], composeDifference[1], multiplyDifference[0], multiplyDifference[1],
+			normalDifference[0], normalDifference[1]);
+		return true;
+	}
+}
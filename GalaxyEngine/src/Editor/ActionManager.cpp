@@ -1,5 +1,8 @@
 #include "pch.h"
 #include "Editor/ActionManager.h"
+
+#include "Core/ObjectSnapshot.h"
+
 namespace GALAXY 
 {
 
@@ -15,4 +18,47 @@ namespace GALAXY
 		}
 	}
 
+	size_t Editor::ActionManager::GetMemoryUsage() const
+	{
+		size_t usage = 0;
+		for (const std::deque<Action>* stack : { &undoStack, &redoStack })
+		{
+			for (const Action& action : *stack)
+			{
+				if (const Shared<Core::ObjectSnapshot>& snapshot = action.GetSnapshot())
+					usage += snapshot->GetMemorySize();
+			}
+		}
+		return usage;
+	}
+
+	void Editor::ActionManager::TrimHistory()
+	{
+		// The most recent actions stay uncompressed so they are undone without delay
+		constexpr size_t uncompressedActionCount = 4;
+		if (undoStack.size() > uncompressedActionCount)
+		{
+			for (size_t i = 0; i < undoStack.size() - uncompressedActionCount; i++)
+			{
+				if (const Shared<Core::ObjectSnapshot>& snapshot = undoStack[i].GetSnapshot())
+					snapshot->Compress();
+			}
+		}
+
+		// The redo stack counts in the budget, the actions furthest from the current state are removed first
+		size_t usage = GetMemoryUsage();
+		while (usage > m_memoryBudget && !redoStack.empty())
+		{
+			if (const Shared<Core::ObjectSnapshot>& snapshot = redoStack.front().GetSnapshot())
+				usage -= snapshot->GetMemorySize();
+			redoStack.pop_front();
+		}
+		while (usage > m_memoryBudget && undoStack.size() > 1)
+		{
+			if (const Shared<Core::ObjectSnapshot>& snapshot = undoStack.front().GetSnapshot())
+				usage -= snapshot->GetMemorySize();
+			undoStack.pop_front();
+		}
+	}
+
 }
@@ -35,7 +35,25 @@ namespace GALAXY
 		m_translationMatrix = Mat4::CreateTranslationMatrix(m_currentPosition);
 	}
 
-	void Editor::EditorIcon::Render(uint64_t id/*= -1*/)
+	bool Editor::EditorIcon::Raycast(const Physic::Ray& ray, const Vec3f& cameraUp, const Vec3f& cameraRight, float& distance) const
+	{
+		// Half size of the plane once scaled by the billboard shader
+		constexpr float halfSize = 0.5f;
+		const Vec3f normal = cameraRight.Cross(cameraUp);
+		const float denominator = ray.direction.Dot(normal);
+		if (std::abs(denominator) < 1e-6f)
+			return false;
+		const float hitDistance = (m_currentPosition - ray.origin).Dot(normal) / denominator;
+		if (hitDistance < 0.f || hitDistance > ray.scale)
+			return false;
+		const Vec3f offset = ray.origin + ray.direction * hitDistance - m_currentPosition;
+		if (std::abs(offset.Dot(cameraRight)) > halfSize || std::abs(offset.Dot(cameraUp)) > halfSize)
+			return false;
+		distance = hitDistance;
+		return true;
+	}
+
+	void Editor::EditorIcon::Render()
 	{
 		Wrapper::Renderer* renderer = Wrapper::Renderer::GetInstance();
 
@@ -47,7 +65,7 @@ namespace GALAXY
 		ASSERT(m_material);
 		ASSERT(m_material->GetShader());
 
-		m_plane.lock()->Render(m_translationMatrix, { m_material }, id);
+		m_plane.lock()->Render(m_translationMatrix, { m_material });
 	}
 
 }
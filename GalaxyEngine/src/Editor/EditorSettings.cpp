@@ -130,6 +130,16 @@ namespace GALAXY
 		{
 			Core::Application::GetInstance().GetWindow()->SetVSync(enableVSync);
 		}
+		if (ImGui::Checkbox("Auto Save", &m_autoSave))
+		{
+			SaveSettings();
+		}
+		ImGui::BeginDisabled(!m_autoSave);
+		if (ImGui::DragFloat("Auto Save Interval", &m_autoSaveInterval, 1.f, 10.f, 3600.f, "%.0f s"))
+		{
+			SaveSettings();
+		}
+		ImGui::EndDisabled();
 	}
 
 	void Editor::EditorSettings::DisplayExternalToolTab()
@@ -228,6 +238,8 @@ namespace GALAXY
 		CppSer::Serializer serializer("Editor.settings");
 		serializer << CppSer::Pair::BeginMap << "Editor Settings";
 		serializer << CppSer::Pair::Key << "Script Editor Tool" << CppSer::Pair::Value << static_cast<int>(GetScriptEditorTool());
+		serializer << CppSer::Pair::Key << "Auto Save" << CppSer::Pair::Value << m_autoSave;
+		serializer << CppSer::Pair::Key << "Auto Save Interval" << CppSer::Pair::Value << m_autoSaveInterval;
 		serializer << CppSer::Pair::EndMap << "Editor Settings";
 	}
 
@@ -240,6 +252,9 @@ namespace GALAXY
 			return;
 		}
 		m_scriptEditorTool = static_cast<Editor::ScriptEditorTool>(parser["Script Editor Tool"].As<int>());
+		m_autoSave = parser["Auto Save"].As<bool>();
+		if (const float autoSaveInterval = parser["Auto Save Interval"].As<float>(); autoSaveInterval > 0.f)
+			m_autoSaveInterval = autoSaveInterval;
 
 		std::filesystem::path thumbnailPath = Resource::ResourceManager::GetInstance()->GetProjectPath() / PROJECT_THUMBNAIL_PATH;
 		m_projectThumbnail = Resource::ResourceManager::GetOrLoad<Resource::Texture>(thumbnailPath);
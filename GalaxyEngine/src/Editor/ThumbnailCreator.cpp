@@ -34,15 +34,15 @@ namespace GALAXY
 		m_scene = std::make_shared<Resource::Scene>("Temp");
 		m_scene->Initialize();
 
-		m_cameraObject = std::make_shared<Core::GameObject>("Camera");
+		m_cameraObject = Core::GameObject::Create("Camera");
 		m_scene->AddObject(m_cameraObject);
 		m_camera = m_cameraObject->AddComponent<Component::CameraComponent>().lock();
 		m_camera->SetClearColor(clearColor);
 
-		m_sphereMaterialObject = std::make_shared<Core::GameObject>("Sphere");
+		m_sphereMaterialObject = Core::GameObject::Create("Sphere");
 		m_scene->AddObject(m_sphereMaterialObject);
 
-		auto lightObject = std::make_shared<Core::GameObject>("Directional");
+		auto lightObject = Core::GameObject::Create("Directional");
 		m_scene->AddObject(lightObject);
 		lightObject->AddComponent<Component::DirectionalLight>();
 
@@ -3,6 +3,17 @@
 
 #include "Editor/UI/EditorUIManager.h"
 
+#include "Debug/Benchmark.h"
+#include "Debug/SelfTest.h"
+
+#include "Component/IComponent.h"
+
+#include "Core/SceneHolder.h"
+#include "Core/SystemScheduler.h"
+
+#include "Utils/MemoryPool.h"
+#include "Utils/Arena.h"
+
 namespace GALAXY 
 {
 
@@ -15,6 +26,48 @@ namespace GALAXY
 			ImGui::Text("Triangle draw count: %zu", m_triangleDrawCount);
 			ResetTriangleDrawCount();
 
+			if (ImGui::Button("Run Transform Benchmarks"))
+				Debug::Benchmark::RunTransformBenchmarks();
+			if (ImGui::Button("Run Culling Benchmarks"))
+				Debug::Benchmark::RunCullingBenchmarks();
+			if (ImGui::Button("Run Hierarchy Benchmarks"))
+				Debug::Benchmark::RunHierarchyBenchmarks();
+			if (ImGui::Button("Run Occlusion Benchmarks"))
+				Debug::Benchmark::RunOcclusionBenchmarks();
+			if (ImGui::Button("Run Spatial Index Test"))
+				Debug::SelfTest::RunSpatialIndexTest();
+			if (ImGui::Button("Run Transform Kernel Test"))
+				Debug::SelfTest::RunTransformKernelTest();
+
+			if (ImGui::Button("Dump System Schedule"))
+			{
+				if (Core::SystemScheduler* scheduler = Core::SceneHolder::GetCurrentScene()->GetSystemScheduler())
+					scheduler->DumpGraph("Cache/schedule.dot");
+			}
+
+			if (ImGui::TreeNode("Component Pools"))
+			{
+				for (Component::ComponentPoolBase* pool : Component::ComponentPoolBase::GetPools())
+				{
+					if (const Component::BaseComponent* component = pool->GetAny())
+						ImGui::Text("%s : %zu", component->GetComponentName(), pool->GetCount());
+				}
+				ImGui::TreePop();
+			}
+
+			if (ImGui::TreeNode("Memory Pool"))
+			{
+				for (const Utils::MemoryPool::Stats& stats : Utils::MemoryPool::GetStats())
+				{
+					if (stats.reserved > 0)
+						ImGui::Text("%zu bytes : %zu used, %zu KB reserved", stats.size, stats.used, stats.reserved / 1024);
+				}
+				ImGui::Text("Large allocations : %zu", Utils::MemoryPool::GetLargeCount());
+				if (const Utils::Arena* arena = Core::SceneHolder::GetCurrentScene()->GetFrameArena())
+					ImGui::Text("Frame arena : %zu KB used, %zu KB peak, %zu KB reserved", arena->GetUsed() / 1024, arena->GetPeak() / 1024, arena->GetReserved() / 1024);
+				ImGui::TreePop();
+			}
+
 			std::set<Core::UUID> loadingResources = EditorUIManager::GetInstance()->GetLoadingResources();
 			std::string label = "Loading Resources : " + std::to_string(loadingResources.size());
 			if (!loadingResources.empty())
@@ -5,6 +5,7 @@
 #include "Editor/UI/Hierarchy.h"
 
 #include "Core/Application.h"
+#include "Editor/EditorSettings.h"
 
 #include "Core/SceneHolder.h"
 #include "Resource/Scene.h"
@@ -36,7 +37,7 @@ namespace GALAXY {
 	void Editor::UI::EditorUIManager::BindEvents()
 	{
 		std::function<void(const Vec2i&)> bind = std::bind(&EditorUIManager::DPIChangeCallback, this, std::placeholders::_1);
-		Core::Application::GetInstance().GetWindow()->EOnDPIChange.Bind(bind);
+		m_dpiChangeSubscription = Core::Application::GetInstance().GetWindow()->EOnDPIChange.Subscribe(bind);
 	}
 
 	void Editor::UI::EditorUIManager::DrawUI()
@@ -58,6 +59,23 @@ namespace GALAXY {
 			ImGui::OpenPopup("Are you sure ?");
 			DisplayClosePopup();
 		}
+
+		UpdateAutoSave();
+	}
+
+	void Editor::UI::EditorUIManager::UpdateAutoSave()
+	{
+		const EditorSettings& editorSettings = Core::Application::GetInstance().GetEditorSettings();
+		const double time = ImGui::GetTime();
+		if (!editorSettings.IsAutoSaveEnable() || time - m_lastAutoSaveTime < editorSettings.GetAutoSaveInterval())
+			return;
+		m_lastAutoSaveTime = time;
+
+		Resource::Scene* currentScene = Core::SceneHolder::GetCurrentScene();
+		// Scenes never saved need a path chosen by the user
+		if (!currentScene->HasBeenSent() || !currentScene->GetFileInfo().Exist() || !currentScene->WasModified())
+			return;
+		currentScene->SaveAsync();
 	}
 
 	void Editor::UI::EditorUIManager::DisplayClosePopup()
@@ -81,7 +99,7 @@ namespace GALAXY {
 				{
 					if (const std::string path = Utils::OS::SaveDialog(filters); !path.empty())
 					{
-						MainBar::SaveScene(path);
+						MainBar::SaveScene(path, false);
 						Core::Application::GetInstance().GetWindow()->ForceClose();
 					}
 				}
@@ -4,6 +4,7 @@
 #include "Core/SceneHolder.h"
 #include "Core/GameObject.h"
 #include "Core/Application.h"
+#include "Core/ObjectSnapshot.h"
 
 #include "Resource/Scene.h"
 
@@ -11,6 +12,8 @@
 #include "Resource/Prefab.h"
 #include "Resource/ResourceManager.h"
 
+#include <unordered_set>
+
 using namespace Core;
 
 void Editor::UI::Hierarchy::Draw()
@@ -25,6 +28,13 @@ void Editor::UI::Hierarchy::Draw()
         uint64_t index = 0;
         DisplayGameObject(root, index);
 
+        // Checked once the tree is drawn, destroying objects while iterating the children is not safe
+        if ((ImGui::IsWindowFocused() || EditorUIManager::GetInstance()->GetSceneWindow()->IsFocused()) &&
+            ImGui::IsKeyPressed(ImGuiKey_Delete))
+        {
+            DestroySelected();
+        }
+
         if (m_openRightClick)
         {
             ImGui::OpenPopup("RightClick");
@@ -41,7 +51,7 @@ void Editor::UI::Hierarchy::DisplayGameObject(const Weak<GameObject>& weakGO, ui
     if (!gameobject)
         return;
 
-    gameobject->m_sceneGraphID = index;
+    gameobject->SetSceneGraphID(index);
 
     if (!display)
     {
@@ -95,7 +105,7 @@ void Editor::UI::Hierarchy::DisplayGameObject(const Weak<GameObject>& weakGO, ui
         Wrapper::GUI::InputText("##InputText", &name);
         if (m_renameObject && !m_openRename && !ImGui::IsItemActive())
         {
-            m_renameObject->m_name = name;
+            m_renameObject->SetName(name);
             m_renameObject = nullptr;
         }
         m_openRename = false;
@@ -168,18 +178,6 @@ void Editor::UI::Hierarchy::DisplayGameObject(const Weak<GameObject>& weakGO, ui
             m_inspector->ClearSelected();
         }
     }
-    if ((ImGui::IsWindowFocused() || EditorUIManager::GetInstance()->GetSceneWindow()->IsFocused()) &&
-        ImGui::IsKeyPressed(ImGuiKey_Delete))
-    {
-        for (const Weak<GameObject>& object : m_inspector->GetSelectedGameObjects())
-        {
-            if (!object.lock())
-                continue;
-
-            object.lock()->Destroy();
-        }
-    }
-
     // === Drag And Drop === //
     if (gameobject->m_parent.lock() && ImGui::BeginDragDropSource())
     {
@@ -267,7 +265,8 @@ void Editor::UI::Hierarchy::DisplayGameObject(const Weak<GameObject>& weakGO, ui
             drawList->AddLine(cursorPos, cursorPos + Vec2f(centerX, 0), white);
         
         Wrapper::GUI::TreePush(child->m_name.c_str(), ImGui::GetFrameHeight());
-        DisplayGameObject(child, i, display);
+        index++;
+        DisplayGameObject(child, index, display);
         Wrapper::GUI::TreePop(ImGui::GetFrameHeight());
     }        
 
@@ -328,6 +327,84 @@ void CreateGameObject(const List<Weak<GameObject>>& selected)
     }
 }
 
+void Editor::UI::Hierarchy::DestroySelected() const
+{
+    Resource::Scene* currentScene = SceneHolder::GetCurrentScene();
+
+    // Only keep the top most objects, their children are destroyed with them
+    const List<Weak<GameObject>> selected = m_inspector->GetSelectedGameObjects();
+    std::unordered_set<const GameObject*> selectedSet;
+    for (const Weak<GameObject>& object : selected)
+    {
+        selectedSet.insert(object.lock().get());
+    }
+    List<Shared<GameObject>> objects;
+    for (const Weak<GameObject>& object : selected)
+    {
+        const Shared<GameObject> lockObject = object.lock();
+        if (!lockObject || !lockObject->GetParent())
+            continue;
+        bool parentSelected = false;
+        for (Shared<GameObject> parent = lockObject->GetParent(); parent && !parentSelected; parent = parent->GetParent())
+            parentSelected = selectedSet.contains(parent.get());
+        if (!parentSelected)
+            objects.push_back(lockObject);
+    }
+    if (objects.empty())
+        return;
+
+    // Restore in hierarchy order so the sibling indices stay valid
+    std::ranges::sort(objects, [](const Shared<GameObject>& a, const Shared<GameObject>& b)
+        {
+            return a->GetSceneGraphID() < b->GetSceneGraphID();
+        });
+
+    List<Core::UUID> uuids;
+    List<Core::UUID> parents;
+    List<uint32_t> indices;
+    for (const Shared<GameObject>& object : objects)
+    {
+        const Shared<GameObject> parent = object->GetParent();
+        uuids.push_back(object->GetUUID());
+        parents.push_back(parent->GetUUID());
+        indices.push_back(parent->GetChildIndex(object.get()));
+    }
+    const Shared<ObjectSnapshot> snapshot = std::make_shared<ObjectSnapshot>(objects);
+    objects.clear();
+
+    auto destroyObjects = [currentScene = currentScene, uuids = uuids]()
+    {
+        List<Shared<GameObject>> objectsToDestroy;
+        objectsToDestroy.reserve(uuids.size());
+        for (const Core::UUID& uuid : uuids)
+        {
+            if (const Shared<GameObject> object = currentScene->GetWithUUID(uuid).lock())
+                objectsToDestroy.push_back(object);
+        }
+        currentScene->DestroyObjects(objectsToDestroy);
+    };
+
+    m_inspector->ClearSelected();
+    destroyObjects();
+    Editor::Action action(
+        destroyObjects,
+        [currentScene = currentScene, snapshot = snapshot, parents = parents, indices = indices]()
+        {
+            const List<Shared<GameObject>> restored = snapshot->Restore(true);
+            for (size_t i = 0; i < restored.size(); i++)
+            {
+                Shared<GameObject> parent = currentScene->GetWithUUID(parents[i]).lock();
+                if (!parent)
+                    parent = currentScene->GetRootGameObject().lock();
+                parent->AddChild(restored[i], std::min(indices[i], static_cast<uint32_t>(parent->GetChildCount())));
+                restored[i]->FinishDeserialize();
+                restored[i]->AfterLoad();
+            }
+        });
+    action.SetSnapshot(snapshot);
+    currentScene->GetActionManager()->AddAction(action);
+}
+
 void Editor::UI::Hierarchy::RightClickPopup()
 {
     if (ImGui::BeginPopup("RightClick", ImGuiWindowFlags_NoDecoration))
@@ -382,10 +459,7 @@ void Editor::UI::Hierarchy::RightClickPopup()
 
             if (ImGui::Button("Delete", buttonSize))
             {
-                for (const Weak<GameObject>& i : selected)
-                {
-                    i.lock()->Destroy();
-                }
+                DestroySelected();
                 ImGui::CloseCurrentPopup();
             }
 
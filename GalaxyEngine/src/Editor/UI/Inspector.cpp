@@ -61,7 +61,7 @@ void Editor::UI::Inspector::ShowGameObject(Core::GameObject* object)
 	// Transform
 	if (ImGui::CollapsingHeader("Transform", ImGuiTreeNodeFlags_DefaultOpen))
 	{
-		object->m_transform->ShowInInspector();
+		object->m_transform.ShowInInspector();
 	}
 
 	// Other Components
@@ -125,6 +125,11 @@ void Editor::UI::Inspector::ShowGameObject(Core::GameObject* object)
 	}
 
 	ImGui::EndDisabled();
+
+	// Any value edited through the inspector widgets changes the serialized object
+	if (ImGui::GetCurrentContext()->ActiveIdHasBeenEditedThisFrame)
+		object->SetModified();
+
 	if (openPopup)
 	{
 		ImGui::OpenPopup("RightClickPopup");
@@ -173,10 +178,10 @@ void Editor::UI::Inspector::ShowFile(const File* file) const
 void Editor::UI::Inspector::AddSelected(const Weak<Core::GameObject>& gameObject)
 {
 	m_mode = InspectorMode::Scene;
-	auto it = std::ranges::remove_if(m_selectedGameObject,
-		[&](const Weak<Core::GameObject>& c) {	return c.lock() == gameObject.lock(); }).begin();
-	if (it != m_selectedGameObject.end()) {
-		m_selectedGameObject.erase(it);
+	// The selected flag tells if the object is in the list, the list is only searched to unselect it
+	if (gameObject.lock()->m_selected) {
+		std::erase_if(m_selectedGameObject,
+			[&](const Weak<Core::GameObject>& c) {	return c.lock() == gameObject.lock(); });
 		gameObject.lock()->m_selected = false;
 	}
 	else {
@@ -288,7 +293,9 @@ void Editor::UI::Inspector::RightClickPopup()
 		}
 		else if (ImGui::Button("Reset", buttonSize))
 		{
+			Core::GameObject* owner = m_rightClicked.lock()->GetGameObject();
 			m_rightClicked.lock()->Reset();
+			owner->SetModified();
 		}
 		ImGui::EndPopup();
 	}
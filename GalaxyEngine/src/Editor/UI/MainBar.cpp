@@ -153,12 +153,16 @@ namespace GALAXY
 					m_waitingModel = modelShared;
 					if (!modelShared->IsLoaded()) {
 						auto bind = [this] { AddModelToScene(); };
-						modelShared->OnLoad.Bind(bind);
+						m_modelLoadSubscription = modelShared->OnLoad.Subscribe(bind);
 						return;
 					}
 					AddModelToScene();
 				}
 			}
+			if (Core::SceneHolder::GetCurrentScene()->IsSaving())
+			{
+				ImGui::TextDisabled("Saving...");
+			}
 			ImGui::EndMainMenuBar();
 		}
 	}
@@ -172,13 +176,16 @@ namespace GALAXY
 		Core::SceneHolder::GetInstance()->SwitchScene(sceneResource);
 	}
 
-	void Editor::UI::MainBar::SaveScene(std::string path)
+	void Editor::UI::MainBar::SaveScene(std::string path, const bool async)
 	{
 		if (path.find(".galaxy") == std::string::npos)
 			path = path + ".galaxy";
 
-		const Resource::Scene* scene = Core::SceneHolder::GetCurrentScene();
-		scene->Save(path);
+		Resource::Scene* scene = Core::SceneHolder::GetCurrentScene();
+		if (async)
+			scene->SaveAsync(path);
+		else
+			scene->Save(path);
 	}
 
 	void Editor::UI::MainBar::AddModelToScene() const
@@ -28,6 +28,7 @@ namespace GALAXY
 			static ImGuiTextFilter filter;
 			filter.Draw();
 			ImGui::BeginChild("List", Vec2f(0), true);
+			std::lock_guard lock(Resource::ResourceManager::GetInstance()->GetResourceMutex());
 			for (auto& resource : *m_resources)
 			{
 				if (!filter.PassFilter(resource.first.string().c_str()))
@@ -0,0 +1,637 @@
+#include "pch.h"
+#include "Physic/DynamicBVH.h"
+
+#include "Core/ThreadManager.h"
+
+#include <numeric>
+
+namespace GALAXY
+{
+	// Under this number of proxies the tree is never rebuilt
+	constexpr size_t rebuildMinProxyCount = 16;
+	constexpr int binCount = 16;
+
+	uint32_t Physic::DynamicBVH::CreateProxy(const AABB& bounds, const ObjectHandle object)
+	{
+		uint32_t proxy;
+		if (!m_freeProxies.empty())
+		{
+			proxy = m_freeProxies.back();
+			m_freeProxies.pop_back();
+		}
+		else
+		{
+			proxy = static_cast<uint32_t>(m_proxies.size());
+			m_proxies.emplace_back();
+		}
+
+		const uint32_t leaf = AllocateNode();
+		m_nodes[leaf].bounds = bounds.Enlarge(m_margin);
+		m_nodes[leaf].proxy = proxy;
+
+		Proxy& data = m_proxies[proxy];
+		data.bounds = bounds;
+		data.object = object;
+		data.leaf = leaf;
+		data.used = true;
+		m_proxyCount++;
+
+		InsertLeaf(leaf);
+		if (m_rebuild)
+			m_changedProxies.push_back(proxy);
+		return proxy;
+	}
+
+	void Physic::DynamicBVH::DestroyProxy(const uint32_t proxy)
+	{
+		ASSERT(IsProxyValid(proxy));
+		Proxy& data = m_proxies[proxy];
+		RemoveLeaf(data.leaf);
+		FreeNode(data.leaf);
+		data = Proxy();
+		m_freeProxies.push_back(proxy);
+		m_proxyCount--;
+		if (m_rebuild)
+			m_changedProxies.push_back(proxy);
+	}
+
+	bool Physic::DynamicBVH::MoveProxy(const uint32_t proxy, const AABB& bounds)
+	{
+		ASSERT(IsProxyValid(proxy));
+		Proxy& data = m_proxies[proxy];
+		data.bounds = bounds;
+		Node& leaf = m_nodes[data.leaf];
+		if (leaf.bounds.Contains(bounds))
+			return false;
+
+		leaf.bounds = bounds.Enlarge(m_margin);
+		Refit(leaf.parent);
+		if (m_rebuild)
+			m_changedProxies.push_back(proxy);
+		return true;
+	}
+
+	void Physic::DynamicBVH::Update()
+	{
+		if (m_rebuild && m_rebuild->finished.load())
+		{
+			const Shared<RebuildState> state = std::move(m_rebuild);
+			ApplyRebuild(*state);
+		}
+
+		if (m_rebuild || m_proxyCount < rebuildMinProxyCount)
+			return;
+		if (GetCost() > m_costAfterRebuild * m_rebuildThreshold)
+			StartRebuild(m_backgroundRebuild);
+	}
+
+	void Physic::DynamicBVH::Rebuild()
+	{
+		// The running rebuild is ignored, its task only owns its state
+		m_rebuild.reset();
+		m_changedProxies.clear();
+		StartRebuild(false);
+	}
+
+	void Physic::DynamicBVH::QueryFrustum(const Frustum& frustum, List<ObjectHandle>& result) const
+	{
+		List<uint32_t> proxies;
+		CullFrustum(frustum, proxies);
+		result.reserve(result.size() + proxies.size());
+		for (const uint32_t proxy : proxies)
+		{
+			result.push_back(m_proxies[proxy].object);
+		}
+	}
+
+	void Physic::DynamicBVH::CullFrustum(const Frustum& frustum, List<uint32_t>& proxies, FrustumCullCache* cache) const
+	{
+		if (m_root == INDEX_NONE)
+			return;
+		// The node indices change with the rebuilds, a stale plane only changes the test order
+		if (cache)
+			cache->planes.resize(m_nodes.size(), 0);
+
+		struct Entry
+		{
+			uint32_t node;
+			// One bit per plane the box is not yet known to be in front of
+			uint8_t planes;
+		};
+		List<Entry> stack;
+		stack.reserve(64);
+		stack.push_back({ m_root, 0x3F });
+		while (!stack.empty())
+		{
+			const Entry entry = stack.back();
+			stack.pop_back();
+			const Node& node = m_nodes[entry.node];
+
+			uint8_t planes = entry.planes;
+			bool outside = false;
+			if (planes != 0)
+			{
+				const AABB& bounds = node.IsLeaf() ? m_proxies[node.proxy].bounds : node.bounds;
+				const Vec3f center = bounds.GetCenter();
+				const Vec3f extents = bounds.GetExtents();
+				const int firstPlane = cache ? cache->planes[entry.node] : 0;
+				for (int i = 0; i < 6; i++)
+				{
+					const int planeIndex = (firstPlane + i) % 6;
+					if (!(planes & (1 << planeIndex)))
+						continue;
+					const Plane& plane = frustum.planes[planeIndex];
+					const float radius = extents.x * std::abs(plane.normal.x) + extents.y * std::abs(plane.normal.y) + extents.z * std::abs(plane.normal.z);
+					const float distance = plane.GetDistanceToPlane(center);
+					if (distance < -radius)
+					{
+						if (cache)
+							cache->planes[entry.node] = static_cast<uint8_t>(planeIndex);
+						outside = true;
+						break;
+					}
+					// The children are inside the box, so in front of this plane too
+					if (distance >= radius)
+						planes &= ~(1 << planeIndex);
+				}
+			}
+			if (outside)
+				continue;
+
+			if (node.IsLeaf())
+				proxies.push_back(node.proxy);
+			else
+			{
+				stack.push_back({ node.children[0], planes });
+				stack.push_back({ node.children[1], planes });
+			}
+		}
+	}
+
+	void Physic::DynamicBVH::CullFrustums(const Frustum* frustums, const uint32_t frustumCount, List<uint32_t>* proxies) const
+	{
+		ASSERT(frustumCount <= maxCullFrustums);
+		if (m_root == INDEX_NONE || frustumCount == 0)
+			return;
+
+		struct Entry
+		{
+			uint32_t node;
+			// One bit per frustum the box may still be in
+			uint8_t frustums;
+			// For each frustum, one bit per plane the box is not yet known to be in front of
+			uint8_t planes[maxCullFrustums];
+		};
+		List<Entry> stack;
+		stack.reserve(64);
+		Entry& root = stack.emplace_back();
+		root.node = m_root;
+		root.frustums = static_cast<uint8_t>((1u << frustumCount) - 1);
+		std::fill_n(root.planes, frustumCount, static_cast<uint8_t>(0x3F));
+		while (!stack.empty())
+		{
+			Entry entry = stack.back();
+			stack.pop_back();
+			const Node& node = m_nodes[entry.node];
+
+			// The box is only read when a frustum does not contain it yet
+			Vec3f center;
+			Vec3f extents;
+			bool boundsRead = false;
+			for (uint32_t view = 0; view < frustumCount; view++)
+			{
+				if (!(entry.frustums & (1 << view)) || entry.planes[view] == 0)
+					continue;
+				if (!boundsRead)
+				{
+					const AABB& bounds = node.IsLeaf() ? m_proxies[node.proxy].bounds : node.bounds;
+					center = bounds.GetCenter();
+					extents = bounds.GetExtents();
+					boundsRead = true;
+				}
+				for (int planeIndex = 0; planeIndex < 6; planeIndex++)
+				{
+					if (!(entry.planes[view] & (1 << planeIndex)))
+						continue;
+					const Plane& plane = frustums[view].planes[planeIndex];
+					const float radius = extents.x * std::abs(plane.normal.x) + extents.y * std::abs(plane.normal.y) + extents.z * std::abs(plane.normal.z);
+					const float distance = plane.GetDistanceToPlane(center);
+					if (distance < -radius)
+					{
+						entry.frustums &= ~(1 << view);
+						break;
+					}
+					// The children are inside the box, so in front of this plane too
+					if (distance >= radius)
+						entry.planes[view] &= ~(1 << planeIndex);
+				}
+			}
+			if (entry.frustums == 0)
+				continue;
+
+			if (node.IsLeaf())
+			{
+				for (uint32_t view = 0; view < frustumCount; view++)
+				{
+					if (entry.frustums & (1 << view))
+						proxies[view].push_back(node.proxy);
+				}
+				continue;
+			}
+			entry.node = node.children[0];
+			stack.push_back(entry);
+			entry.node = node.children[1];
+			stack.push_back(entry);
+		}
+	}
+
+	void Physic::DynamicBVH::QueryAABB(const AABB& bounds, List<ObjectHandle>& result) const
+	{
+		Traverse([&bounds](const AABB& nodeBounds) { return nodeBounds.Intersects(bounds); },
+			[&](const uint32_t proxy) { result.push_back(m_proxies[proxy].object); });
+	}
+
+	void Physic::DynamicBVH::QuerySphere(const Vec3f& center, const float radius, List<ObjectHandle>& result) const
+	{
+		Traverse([&center, radius](const AABB& nodeBounds) { return nodeBounds.IntersectsSphere(center, radius); },
+			[&](const uint32_t proxy) { result.push_back(m_proxies[proxy].object); });
+	}
+
+	void Physic::DynamicBVH::QueryRay(const Ray& ray, List<ObjectHandle>& result) const
+	{
+		Traverse([&ray](const AABB& nodeBounds) { float distance; return nodeBounds.IntersectsRay(ray, distance); },
+			[&](const uint32_t proxy) { result.push_back(m_proxies[proxy].object); });
+	}
+
+	Physic::DynamicBVH::ObjectHandle Physic::DynamicBVH::RaycastClosest(const Ray& ray, float* distance) const
+	{
+		ObjectHandle closest;
+		if (m_root == INDEX_NONE)
+			return closest;
+
+		float closestDistance = FLT_MAX;
+		List<std::pair<uint32_t, float>> stack;
+		stack.reserve(64);
+		float rootDistance;
+		if (m_nodes[m_root].bounds.IntersectsRay(ray, rootDistance))
+			stack.push_back({ m_root, rootDistance });
+		while (!stack.empty())
+		{
+			const auto [index, entryDistance] = stack.back();
+			stack.pop_back();
+			// A closer object was found since the node was pushed
+			if (entryDistance >= closestDistance)
+				continue;
+
+			const Node& node = m_nodes[index];
+			if (node.IsLeaf())
+			{
+				float leafDistance;
+				if (m_proxies[node.proxy].bounds.IntersectsRay(ray, leafDistance) && leafDistance < closestDistance)
+				{
+					closestDistance = leafDistance;
+					closest = m_proxies[node.proxy].object;
+				}
+				continue;
+			}
+
+			float childDistances[2];
+			bool childHits[2];
+			for (int i = 0; i < 2; i++)
+			{
+				childHits[i] = m_nodes[node.children[i]].bounds.IntersectsRay(ray, childDistances[i]) && childDistances[i] < closestDistance;
+			}
+			// The closest child is pushed last so it is visited first
+			const int first = childHits[0] && childHits[1] && childDistances[1] < childDistances[0] ? 1 : 0;
+			for (const int i : { 1 - first, first })
+			{
+				if (childHits[i])
+					stack.push_back({ node.children[i], childDistances[i] });
+			}
+		}
+
+		if (distance && closest.index != INDEX_NONE)
+			*distance = closestDistance;
+		return closest;
+	}
+
+	float Physic::DynamicBVH::GetCost() const
+	{
+		if (m_root == INDEX_NONE)
+			return 0.f;
+		const float rootArea = m_nodes[m_root].bounds.GetSurfaceArea();
+		return rootArea > 0.f ? m_internalArea / rootArea : 0.f;
+	}
+
+	uint32_t Physic::DynamicBVH::AllocateNode()
+	{
+		if (!m_freeNodes.empty())
+		{
+			const uint32_t node = m_freeNodes.back();
+			m_freeNodes.pop_back();
+			return node;
+		}
+		m_nodes.emplace_back();
+		return static_cast<uint32_t>(m_nodes.size() - 1);
+	}
+
+	void Physic::DynamicBVH::FreeNode(const uint32_t node)
+	{
+		m_nodes[node] = Node();
+		m_freeNodes.push_back(node);
+	}
+
+	void Physic::DynamicBVH::InsertLeaf(const uint32_t leaf)
+	{
+		if (m_root == INDEX_NONE)
+		{
+			m_root = leaf;
+			m_nodes[leaf].parent = INDEX_NONE;
+			return;
+		}
+
+		// Go down to the sibling with the lowest increase of area
+		const AABB leafBounds = m_nodes[leaf].bounds;
+		uint32_t index = m_root;
+		while (!m_nodes[index].IsLeaf())
+		{
+			const Node& node = m_nodes[index];
+			const float area = node.bounds.GetSurfaceArea();
+			const float combinedArea = node.bounds.Merge(leafBounds).GetSurfaceArea();
+
+			// Cost of a new parent of this node and the leaf
+			const float cost = 2.f * combinedArea;
+			// Increase of the area of the ancestors if the leaf goes further down
+			const float inheritedCost = 2.f * (combinedArea - area);
+
+			float childCosts[2];
+			for (int i = 0; i < 2; i++)
+			{
+				const Node& child = m_nodes[node.children[i]];
+				const float mergedArea = child.bounds.Merge(leafBounds).GetSurfaceArea();
+				childCosts[i] = (child.IsLeaf() ? mergedArea : mergedArea - child.bounds.GetSurfaceArea()) + inheritedCost;
+			}
+
+			if (cost < childCosts[0] && cost < childCosts[1])
+				break;
+			index = childCosts[0] < childCosts[1] ? node.children[0] : node.children[1];
+		}
+
+		const uint32_t sibling = index;
+		const uint32_t oldParent = m_nodes[sibling].parent;
+		const uint32_t newParent = AllocateNode();
+		Node& parent = m_nodes[newParent];
+		parent.parent = oldParent;
+		parent.bounds = m_nodes[sibling].bounds.Merge(leafBounds);
+		parent.children[0] = sibling;
+		parent.children[1] = leaf;
+		m_internalArea += parent.bounds.GetSurfaceArea();
+		m_nodes[sibling].parent = newParent;
+		m_nodes[leaf].parent = newParent;
+
+		if (oldParent == INDEX_NONE)
+		{
+			m_root = newParent;
+			return;
+		}
+		Node& grandParent = m_nodes[oldParent];
+		grandParent.children[grandParent.children[0] == sibling ? 0 : 1] = newParent;
+		Refit(oldParent);
+	}
+
+	void Physic::DynamicBVH::RemoveLeaf(const uint32_t leaf)
+	{
+		if (leaf == m_root)
+		{
+			m_root = INDEX_NONE;
+			return;
+		}
+
+		const uint32_t parent = m_nodes[leaf].parent;
+		const uint32_t grandParent = m_nodes[parent].parent;
+		const uint32_t sibling = m_nodes[parent].children[m_nodes[parent].children[0] == leaf ? 1 : 0];
+		m_internalArea -= m_nodes[parent].bounds.GetSurfaceArea();
+		FreeNode(parent);
+		m_nodes[leaf].parent = INDEX_NONE;
+		m_nodes[sibling].parent = grandParent;
+
+		if (grandParent == INDEX_NONE)
+		{
+			m_root = sibling;
+			return;
+		}
+		Node& node = m_nodes[grandParent];
+		node.children[node.children[0] == parent ? 0 : 1] = sibling;
+		Refit(grandParent);
+	}
+
+	void Physic::DynamicBVH::Refit(uint32_t node)
+	{
+		while (node != INDEX_NONE)
+		{
+			Node& current = m_nodes[node];
+			const AABB bounds = m_nodes[current.children[0]].bounds.Merge(m_nodes[current.children[1]].bounds);
+			// The ancestors only depend on the box of this node
+			if (bounds.min == current.bounds.min && bounds.max == current.bounds.max)
+				return;
+			m_internalArea += bounds.GetSurfaceArea() - current.bounds.GetSurfaceArea();
+			current.bounds = bounds;
+			node = current.parent;
+		}
+	}
+
+	void Physic::DynamicBVH::StartRebuild(const bool background)
+	{
+		const Shared<RebuildState> state = std::make_shared<RebuildState>();
+		state->bounds.reserve(m_proxyCount);
+		state->proxies.reserve(m_proxyCount);
+		for (uint32_t proxy = 0; proxy < m_proxies.size(); proxy++)
+		{
+			if (!m_proxies[proxy].used)
+				continue;
+			state->bounds.push_back(m_nodes[m_proxies[proxy].leaf].bounds);
+			state->proxies.push_back(proxy);
+		}
+
+#ifdef ENABLE_MULTI_THREAD
+		Core::ThreadManager* threadManager = Core::ThreadManager::GetInstance();
+		if (background && threadManager->GetThreadCount() > 0)
+		{
+			m_rebuild = state;
+			m_changedProxies.clear();
+			// The task only owns the state, the tree can be destroyed before it ends
+			threadManager->AddTask([state]()
+				{
+					Build(*state);
+					state->finished = true;
+				});
+			return;
+		}
+#endif
+		Build(*state);
+		ApplyRebuild(*state);
+	}
+
+	void Physic::DynamicBVH::ApplyRebuild(RebuildState& state)
+	{
+		m_nodes = std::move(state.nodes);
+		m_freeNodes.clear();
+		m_root = state.root;
+		m_internalArea = state.internalArea;
+
+		for (Proxy& proxy : m_proxies)
+		{
+			proxy.leaf = INDEX_NONE;
+		}
+		for (size_t i = 0; i < state.proxies.size(); i++)
+		{
+			m_proxies[state.proxies[i]].leaf = state.leaves[i];
+		}
+
+		// Replace the leaves copied before the changes made during the rebuild
+		std::sort(m_changedProxies.begin(), m_changedProxies.end());
+		m_changedProxies.erase(std::unique(m_changedProxies.begin(), m_changedProxies.end()), m_changedProxies.end());
+		for (const uint32_t proxy : m_changedProxies)
+		{
+			Proxy& data = m_proxies[proxy];
+			if (data.leaf != INDEX_NONE)
+			{
+				RemoveLeaf(data.leaf);
+				FreeNode(data.leaf);
+				data.leaf = INDEX_NONE;
+			}
+			if (!data.used)
+				continue;
+			const uint32_t leaf = AllocateNode();
+			m_nodes[leaf].bounds = data.bounds.Enlarge(m_margin);
+			m_nodes[leaf].proxy = proxy;
+			m_proxies[proxy].leaf = leaf;
+			InsertLeaf(leaf);
+		}
+		m_changedProxies.clear();
+
+		m_costAfterRebuild = GetCost();
+		m_rebuildCount++;
+	}
+
+	void Physic::DynamicBVH::Build(RebuildState& state)
+	{
+		const size_t count = state.bounds.size();
+		state.nodes.clear();
+		state.leaves.assign(count, INDEX_NONE);
+		state.root = INDEX_NONE;
+		state.internalArea = 0.f;
+		if (count == 0)
+			return;
+		// Reserved so the nodes never move during the build
+		state.nodes.reserve(2 * count - 1);
+
+		List<Vec3f> centers(count);
+		for (size_t i = 0; i < count; i++)
+		{
+			centers[i] = state.bounds[i].GetCenter();
+		}
+		List<uint32_t> items(count);
+		std::iota(items.begin(), items.end(), 0);
+
+		struct Task
+		{
+			size_t begin;
+			size_t end;
+			uint32_t parent;
+			int slot;
+		};
+		List<Task> tasks;
+		tasks.push_back({ 0, count, INDEX_NONE, 0 });
+		while (!tasks.empty())
+		{
+			const Task task = tasks.back();
+			tasks.pop_back();
+
+			const uint32_t index = static_cast<uint32_t>(state.nodes.size());
+			Node& node = state.nodes.emplace_back();
+			node.parent = task.parent;
+			if (task.parent == INDEX_NONE)
+				state.root = index;
+			else
+				state.nodes[task.parent].children[task.slot] = index;
+
+			if (task.end - task.begin == 1)
+			{
+				const uint32_t item = items[task.begin];
+				node.bounds = state.bounds[item];
+				node.proxy = state.proxies[item];
+				state.leaves[item] = index;
+				continue;
+			}
+
+			AABB centerBounds;
+			for (size_t i = task.begin; i < task.end; i++)
+			{
+				node.bounds = node.bounds.Merge(state.bounds[items[i]]);
+				centerBounds = centerBounds.Merge(AABB(centers[items[i]], centers[items[i]]));
+			}
+			state.internalArea += node.bounds.GetSurfaceArea();
+
+			// Split along the axis where the centers are the most spread
+			const Vec3f spread = centerBounds.max - centerBounds.min;
+			const int axis = spread.x >= spread.y && spread.x >= spread.z ? 0 : spread.y >= spread.z ? 1 : 2;
+			size_t middle = task.begin + (task.end - task.begin) / 2;
+			if (spread[axis] > 0.f)
+			{
+				const float scale = binCount / spread[axis];
+				auto getBin = [&](const uint32_t item)
+					{
+						return std::min(binCount - 1, static_cast<int>((centers[item][axis] - centerBounds.min[axis]) * scale));
+					};
+
+				AABB binBounds[binCount];
+				size_t binCounts[binCount] = {};
+				for (size_t i = task.begin; i < task.end; i++)
+				{
+					const int bin = getBin(items[i]);
+					binBounds[bin] = binBounds[bin].Merge(state.bounds[items[i]]);
+					binCounts[bin]++;
+				}
+
+				// Cost of the split before each bin, the left side is swept forward and the right side backward
+				float rightCosts[binCount] = {};
+				AABB rightBounds;
+				size_t rightCount = 0;
+				for (int bin = binCount - 1; bin > 0; bin--)
+				{
+					rightBounds = rightBounds.Merge(binBounds[bin]);
+					rightCount += binCounts[bin];
+					rightCosts[bin] = rightCount > 0 ? rightBounds.GetSurfaceArea() * static_cast<float>(rightCount) : 0.f;
+				}
+				float bestCost = FLT_MAX;
+				int bestSplit = -1;
+				AABB leftBounds;
+				size_t leftCount = 0;
+				for (int bin = 1; bin < binCount; bin++)
+				{
+					leftBounds = leftBounds.Merge(binBounds[bin - 1]);
+					leftCount += binCounts[bin - 1];
+					if (leftCount == 0 || leftCount == task.end - task.begin)
+						continue;
+					const float cost = leftBounds.GetSurfaceArea() * static_cast<float>(leftCount) + rightCosts[bin];
+					if (cost < bestCost)
+					{
+						bestCost = cost;
+						bestSplit = bin;
+					}
+				}
+
+				if (bestSplit != -1)
+				{
+					const auto splitItem = std::partition(items.begin() + task.begin, items.begin() + task.end,
+						[&](const uint32_t item) { return getBin(item) < bestSplit; });
+					middle = static_cast<size_t>(splitItem - items.begin());
+				}
+			}
+
+			tasks.push_back({ task.begin, middle, index, 0 });
+			tasks.push_back({ middle, task.end, index, 1 });
+		}
+	}
+}
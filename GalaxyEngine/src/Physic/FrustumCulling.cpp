@@ -0,0 +1,169 @@
+#include "pch.h"
+#include "Physic/FrustumCulling.h"
+
+#include "Core/ThreadManager.h"
+
+#include "Utils/Simd.h"
+
+#include <bit>
+
+namespace GALAXY {
+	// Boxes tested by a worker thread at once
+	constexpr uint32_t cullChunkSize = 8192;
+
+	// Plane with the array of the corner furthest along its normal chosen for each axis
+	struct CullPlane
+	{
+		const float* corners[3];
+		float normal[3];
+		float distance;
+	};
+
+	static void PreparePlanes(const Physic::Frustum& frustum, const Physic::AABBArray& bounds, CullPlane* planes)
+	{
+		for (int i = 0; i < 6; i++)
+		{
+			const Physic::Plane& plane = frustum.planes[i];
+			for (int axis = 0; axis < 3; axis++)
+			{
+				planes[i].normal[axis] = plane.normal[axis];
+				planes[i].corners[axis] = plane.normal[axis] >= 0.f ? bounds.GetMax(axis) : bounds.GetMin(axis);
+			}
+			planes[i].distance = plane.distance;
+		}
+	}
+
+	// Also used for the boxes left by the vector loops
+	static bool IsVisible(const CullPlane* planes, const uint32_t index)
+	{
+		for (int i = 0; i < 6; i++)
+		{
+			const CullPlane& plane = planes[i];
+			const float distance = plane.normal[0] * plane.corners[0][index] + plane.normal[1] * plane.corners[1][index] + plane.normal[2] * plane.corners[2][index];
+			if (distance < plane.distance)
+				return false;
+		}
+		return true;
+	}
+
+	uint32_t Physic::FrustumCulling::CullRange(const Frustum& frustum, const AABBArray& bounds, const uint32_t begin, const uint32_t end, uint32_t* visible)
+	{
+		CullPlane planes[6];
+		PreparePlanes(frustum, bounds, planes);
+
+		uint32_t count = 0;
+		uint32_t index = begin;
+#ifdef GALAXY_SIMD_AVX
+		for (; index + 8 <= end; index += 8)
+		{
+			__m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+			for (const CullPlane& plane : planes)
+			{
+				__m256 distance = _mm256_mul_ps(_mm256_set1_ps(plane.normal[0]), _mm256_loadu_ps(plane.corners[0] + index));
+				distance = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_set1_ps(plane.normal[1]), _mm256_loadu_ps(plane.corners[1] + index)));
+				distance = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_set1_ps(plane.normal[2]), _mm256_loadu_ps(plane.corners[2] + index)));
+				inside = _mm256_and_ps(inside, _mm256_cmp_ps(distance, _mm256_set1_ps(plane.distance), _CMP_GE_OQ));
+			}
+			for (uint32_t bits = static_cast<uint32_t>(_mm256_movemask_ps(inside)); bits != 0; bits &= bits - 1)
+				visible[count++] = index + std::countr_zero(bits);
+		}
+#endif
+#ifdef GALAXY_SIMD_SSE
+		for (; index + 4 <= end; index += 4)
+		{
+			__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+			for (const CullPlane& plane : planes)
+			{
+				__m128 distance = _mm_mul_ps(_mm_set1_ps(plane.normal[0]), _mm_loadu_ps(plane.corners[0] + index));
+				distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.normal[1]), _mm_loadu_ps(plane.corners[1] + index)));
+				distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.normal[2]), _mm_loadu_ps(plane.corners[2] + index)));
+				inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, _mm_set1_ps(plane.distance)));
+			}
+			for (uint32_t bits = static_cast<uint32_t>(_mm_movemask_ps(inside)); bits != 0; bits &= bits - 1)
+				visible[count++] = index + std::countr_zero(bits);
+		}
+#endif
+		for (; index < end; index++)
+		{
+			if (IsVisible(planes, index))
+				visible[count++] = index;
+		}
+		return count;
+	}
+
+	void Physic::FrustumCulling::Cull(const Frustum& frustum, const AABBArray& bounds, List<uint32_t>& visible, const size_t parallelThreshold)
+	{
+		const uint32_t size = static_cast<uint32_t>(bounds.GetSize());
+		visible.resize(size);
+		Core::ThreadManager* threadManager = Core::ThreadManager::GetInstance();
+		if (size < parallelThreshold || threadManager->GetThreadCount() == 0)
+		{
+			visible.resize(CullRange(frustum, bounds, 0, size, visible.data()));
+			return;
+		}
+
+		// Each chunk writes at its own offset, the results are then moved next to each other
+		const uint32_t chunkCount = (size + cullChunkSize - 1) / cullChunkSize;
+		List<uint32_t> counts(chunkCount);
+		threadManager->ParallelFor(chunkCount, [&](const size_t chunk)
+			{
+				const uint32_t begin = static_cast<uint32_t>(chunk) * cullChunkSize;
+				counts[chunk] = CullRange(frustum, bounds, begin, std::min(size, begin + cullChunkSize), visible.data() + begin);
+			});
+		uint32_t count = counts[0];
+		for (uint32_t chunk = 1; chunk < chunkCount; chunk++)
+		{
+			std::copy_n(visible.data() + chunk * cullChunkSize, counts[chunk], visible.data() + count);
+			count += counts[chunk];
+		}
+		visible.resize(count);
+	}
+
+	void Physic::FrustumCulling::CullViews(const Frustum* frustums, const uint32_t frustumCount, const AABBArray& bounds, List<uint32_t>* visible, const size_t parallelThreshold)
+	{
+		const uint32_t size = static_cast<uint32_t>(bounds.GetSize());
+		const uint32_t chunkCount = (size + cullChunkSize - 1) / cullChunkSize;
+		// Number of indices written by each chunk for each frustum
+		List<uint32_t> counts(static_cast<size_t>(chunkCount) * frustumCount);
+		auto cullChunk = [&](const size_t chunk)
+			{
+				const uint32_t begin = static_cast<uint32_t>(chunk) * cullChunkSize;
+				const uint32_t end = std::min(size, begin + cullChunkSize);
+				for (uint32_t view = 0; view < frustumCount; view++)
+				{
+					counts[chunk * frustumCount + view] = CullRange(frustums[view], bounds, begin, end, visible[view].data() + begin);
+				}
+			};
+
+		for (uint32_t view = 0; view < frustumCount; view++)
+		{
+			visible[view].resize(size);
+		}
+		Core::ThreadManager* threadManager = Core::ThreadManager::GetInstance();
+		if (size < parallelThreshold || threadManager->GetThreadCount() == 0)
+		{
+			for (uint32_t chunk = 0; chunk < chunkCount; chunk++)
+			{
+				cullChunk(chunk);
+			}
+		}
+		else
+		{
+			threadManager->ParallelFor(chunkCount, cullChunk);
+		}
+
+		// Each chunk wrote at its own offset, the results are moved next to each other
+		for (uint32_t view = 0; view < frustumCount; view++)
+		{
+			uint32_t count = 0;
+			for (uint32_t chunk = 0; chunk < chunkCount; chunk++)
+			{
+				const uint32_t chunkVisible = counts[chunk * frustumCount + view];
+				if (chunk > 0)
+					std::copy_n(visible[view].data() + chunk * cullChunkSize, chunkVisible, visible[view].data() + count);
+				count += chunkVisible;
+			}
+			visible[view].resize(count);
+		}
+	}
+}
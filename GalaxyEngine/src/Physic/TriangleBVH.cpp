@@ -0,0 +1,233 @@
+#include "pch.h"
+#include "Physic/TriangleBVH.h"
+
+#include "Utils/Define.h"
+
+#include <numeric>
+
+namespace GALAXY
+{
+	constexpr int binCount = 16;
+	// A node with this number of triangles or less becomes a leaf when no split is cheaper
+	constexpr uint32_t maxLeafSize = 4;
+	// Cost of visiting a node relative to testing a triangle
+	constexpr float traversalCost = 1.f;
+
+	void Physic::TriangleBVH::Build(List<Vec3f> positions)
+	{
+		Clear();
+		const size_t count = positions.size() / 3;
+		if (count == 0)
+			return;
+
+		List<AABB> bounds(count);
+		List<Vec3f> centers(count);
+		for (size_t i = 0; i < count; i++)
+		{
+			const Vec3f& a = positions[i * 3];
+			const Vec3f& b = positions[i * 3 + 1];
+			const Vec3f& c = positions[i * 3 + 2];
+			bounds[i] = AABB(a, a).Merge(AABB(b, b)).Merge(AABB(c, c));
+			centers[i] = bounds[i].GetCenter();
+		}
+		List<uint32_t> items(count);
+		std::iota(items.begin(), items.end(), 0);
+
+		// Reserved so the nodes never move during the build
+		m_nodes.reserve(2 * count - 1);
+		Node& root = m_nodes.emplace_back();
+		root.first = 0;
+		root.count = static_cast<uint32_t>(count);
+
+		List<uint32_t> stack;
+		stack.push_back(0);
+		while (!stack.empty())
+		{
+			Node& node = m_nodes[stack.back()];
+			stack.pop_back();
+
+			const uint32_t begin = node.first;
+			const uint32_t end = node.first + node.count;
+			AABB centerBounds;
+			for (uint32_t i = begin; i < end; i++)
+			{
+				node.bounds = node.bounds.Merge(bounds[items[i]]);
+				centerBounds = centerBounds.Merge(AABB(centers[items[i]], centers[items[i]]));
+			}
+			if (node.count == 1)
+				continue;
+
+			// Best split over the bins of every axis
+			float bestCost = FLT_MAX;
+			int bestAxis = -1;
+			int bestSplit = -1;
+			const Vec3f spread = centerBounds.max - centerBounds.min;
+			for (int axis = 0; axis < 3; axis++)
+			{
+				if (!(spread[axis] > 0.f))
+					continue;
+				const float scale = binCount / spread[axis];
+				AABB binBounds[binCount];
+				uint32_t binCounts[binCount] = {};
+				for (uint32_t i = begin; i < end; i++)
+				{
+					const int bin = std::min(binCount - 1, static_cast<int>((centers[items[i]][axis] - centerBounds.min[axis]) * scale));
+					binBounds[bin] = binBounds[bin].Merge(bounds[items[i]]);
+					binCounts[bin]++;
+				}
+
+				// Cost of the split before each bin, the left side is swept forward and the right side backward
+				float rightCosts[binCount] = {};
+				AABB rightBounds;
+				uint32_t rightCount = 0;
+				for (int bin = binCount - 1; bin > 0; bin--)
+				{
+					rightBounds = rightBounds.Merge(binBounds[bin]);
+					rightCount += binCounts[bin];
+					rightCosts[bin] = rightCount > 0 ? rightBounds.GetSurfaceArea() * static_cast<float>(rightCount) : 0.f;
+				}
+				AABB leftBounds;
+				uint32_t leftCount = 0;
+				for (int bin = 1; bin < binCount; bin++)
+				{
+					leftBounds = leftBounds.Merge(binBounds[bin - 1]);
+					leftCount += binCounts[bin - 1];
+					if (leftCount == 0 || leftCount == node.count)
+						continue;
+					const float cost = leftBounds.GetSurfaceArea() * static_cast<float>(leftCount) + rightCosts[bin];
+					if (cost < bestCost)
+					{
+						bestCost = cost;
+						bestAxis = axis;
+						bestSplit = bin;
+					}
+				}
+			}
+
+			// Every center at the same place, the triangles are split in the middle unless they fit in a leaf
+			uint32_t middle = begin + node.count / 2;
+			if (bestAxis != -1)
+			{
+				const float area = node.bounds.GetSurfaceArea();
+				const float splitCost = traversalCost + (area > 0.f ? bestCost / area : 0.f);
+				if (splitCost >= static_cast<float>(node.count) && node.count <= maxLeafSize)
+					continue;
+				const float scale = binCount / spread[bestAxis];
+				const auto splitItem = std::partition(items.begin() + begin, items.begin() + end, [&](const uint32_t item)
+					{
+						return std::min(binCount - 1, static_cast<int>((centers[item][bestAxis] - centerBounds.min[bestAxis]) * scale)) < bestSplit;
+					});
+				middle = static_cast<uint32_t>(splitItem - items.begin());
+			}
+			else if (node.count <= maxLeafSize)
+			{
+				continue;
+			}
+
+			const uint32_t left = static_cast<uint32_t>(m_nodes.size());
+			m_nodes.push_back({ AABB(), begin, middle - begin });
+			m_nodes.push_back({ AABB(), middle, end - middle });
+			// The reference to the node is still valid, the nodes were reserved
+			node.first = left;
+			node.count = 0;
+			stack.push_back(left);
+			stack.push_back(left + 1);
+		}
+		m_nodes.shrink_to_fit();
+
+		// Triangles in the order of the leaves
+		m_positions.resize(count * 3);
+		for (size_t i = 0; i < count; i++)
+		{
+			std::copy_n(positions.begin() + items[i] * 3, 3, m_positions.begin() + i * 3);
+		}
+	}
+
+	void Physic::TriangleBVH::Clear()
+	{
+		m_nodes.clear();
+		m_positions.clear();
+	}
+
+	// Two sided Moller Trumbore test, the distance is in units of the direction
+	static bool IntersectTriangle(const Physic::Ray& ray, const Vec3f& a, const Vec3f& b, const Vec3f& c, float& distance)
+	{
+		const Vec3f edge1 = b - a;
+		const Vec3f edge2 = c - a;
+		const Vec3f p = ray.direction.Cross(edge2);
+		const float determinant = edge1.Dot(p);
+		if (std::abs(determinant) < 1e-12f)
+			return false;
+		const float inverse = 1.f / determinant;
+		const Vec3f t = ray.origin - a;
+		const float u = t.Dot(p) * inverse;
+		if (u < 0.f || u > 1.f)
+			return false;
+		const Vec3f q = t.Cross(edge1);
+		const float v = ray.direction.Dot(q) * inverse;
+		if (v < 0.f || u + v > 1.f)
+			return false;
+		distance = edge2.Dot(q) * inverse;
+		return distance >= 0.f;
+	}
+
+	bool Physic::TriangleBVH::Raycast(const Ray& ray, float& distance, uint32_t* triangle) const
+	{
+		if (m_nodes.empty())
+			return false;
+
+		// The ray is shortened to the closest hit so the farther nodes and triangles are skipped
+		Ray search = ray;
+		uint32_t closest = INDEX_NONE;
+		List<std::pair<uint32_t, float>> stack;
+		stack.reserve(64);
+		float rootDistance;
+		if (m_nodes[0].bounds.IntersectsRay(search, rootDistance))
+			stack.push_back({ 0, rootDistance });
+		while (!stack.empty())
+		{
+			const auto [index, entryDistance] = stack.back();
+			stack.pop_back();
+			// A closer triangle was found since the node was pushed
+			if (entryDistance > search.scale)
+				continue;
+
+			const Node& node = m_nodes[index];
+			if (node.count > 0)
+			{
+				for (uint32_t i = node.first; i < node.first + node.count; i++)
+				{
+					float hitDistance;
+					if (IntersectTriangle(search, m_positions[i * 3], m_positions[i * 3 + 1], m_positions[i * 3 + 2], hitDistance)
+						&& hitDistance <= search.scale)
+					{
+						search.scale = hitDistance;
+						closest = i;
+					}
+				}
+				continue;
+			}
+
+			float childDistances[2];
+			bool childHits[2];
+			for (int i = 0; i < 2; i++)
+			{
+				childHits[i] = m_nodes[node.first + i].bounds.IntersectsRay(search, childDistances[i]);
+			}
+			// The closest child is pushed last so it is visited first
+			const int first = childHits[0] && childHits[1] && childDistances[1] < childDistances[0] ? 1 : 0;
+			for (const int i : { 1 - first, first })
+			{
+				if (childHits[i])
+					stack.push_back({ node.first + i, childDistances[i] });
+			}
+		}
+
+		if (closest == INDEX_NONE)
+			return false;
+		distance = search.scale;
+		if (triangle)
+			*triangle = closest;
+		return true;
+	}
+}
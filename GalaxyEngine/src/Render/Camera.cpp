@@ -51,6 +51,7 @@ namespace GALAXY
 		if (Resource::ResourceManager::GetInstance()->ResourcePopup("PostProcessPopup", ppShader))
 		{
 			p_framebuffer->SetPostProcessShader(ppShader);
+			OnSettingsChanged();
 		}
 	}
 
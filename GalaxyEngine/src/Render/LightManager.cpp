@@ -15,51 +15,50 @@
 namespace GALAXY
 {
 	List<Weak<GALAXY::Resource::Shader>> Render::LightManager::m_shaders;
-	bool Render::LightManager::AddLight(const Weak<Component::Light>& light)
+	bool Render::LightManager::AddLight(Component::Light* light)
 	{
-		const Shared<Component::Light> lightShared = light.lock();
+		const Core::Handle<Component::Light> handle = light->GetHandle();
 		// Check if inside the list
 		size_t freeIndex = INDEX_NONE;
-		auto lightManager = lightShared->GetGameObject()->GetScene()->GetLightManager();
+		auto lightManager = light->GetGameObject()->GetScene()->GetLightManager();
 
-		Component::Light::Type type = lightShared->GetLightType();
+		Component::Light::Type type = light->GetLightType();
 		const size_t startIndex = static_cast<size_t>(type) * MAX_LIGHT_NUMBER;
 		for (size_t i = startIndex; i < startIndex + MAX_LIGHT_NUMBER; i++)
 		{
-			if (freeIndex == INDEX_NONE && lightManager->m_lights[i].lock() == nullptr)
+			if (freeIndex == INDEX_NONE && !lightManager->m_lights[i].IsValid())
 			{
 				freeIndex = i - startIndex;
 			}
-			else if (lightManager->m_lights[i].lock() == lightShared)
+			else if (lightManager->m_lights[i] == handle)
 			{
 				return false;
 			}
 		}
 		if (freeIndex == INDEX_NONE)
 			return false;
-		lightManager->m_lights[startIndex + freeIndex] = light;
-		lightShared->SetLightIndex(freeIndex);
+		lightManager->m_lights[startIndex + freeIndex] = handle;
+		light->SetLightIndex(freeIndex);
 
 		return true;
 	}
 
-	void Render::LightManager::RemoveLight(const Weak<Component::Light>& light)
+	void Render::LightManager::RemoveLight(Component::Light* light)
 	{
-		const Shared<Component::Light> lightShared = light.lock();
-		auto lightManager = lightShared->GetGameObject()->GetScene()->GetLightManager();
-		if (lightShared->GetLightIndex() == INDEX_NONE)
+		auto lightManager = light->GetGameObject()->GetScene()->GetLightManager();
+		if (light->GetLightIndex() == INDEX_NONE)
 			return;
 
-		Component::Light::Type type = lightShared->GetLightType();
+		Component::Light::Type type = light->GetLightType();
 		const size_t startIndex = static_cast<size_t>(type) * MAX_LIGHT_NUMBER;
-		const size_t indexInArray = startIndex + lightShared->GetLightIndex();
+		const size_t indexInArray = startIndex + light->GetLightIndex();
 
-		ResetLightData(lightShared.get());
-		if (lightManager->m_lights[indexInArray].lock() == lightShared)
+		ResetLightData(light);
+		if (lightManager->m_lights[indexInArray] == light->GetHandle())
 		{
-			lightManager->m_lights[indexInArray].reset();
+			lightManager->m_lights[indexInArray] = {};
 		}
-		lightShared->SetLightIndex(INDEX_NONE);
+		light->SetLightIndex(INDEX_NONE);
 	}
 
 	void Render::LightManager::AddShader(const Weak<Resource::Shader>& shader)
@@ -123,11 +122,10 @@ namespace GALAXY
 
 		shader->SendVec3f("camera.viewPos", cameraPos);
 
-		for (const Weak<Component::Light>& light : m_lights)
+		for (const Core::Handle<Component::Light>& light : m_lights)
 		{
-			if (!light.lock())
-				continue;
-			light.lock()->SendLightValues(shader);
+			if (Component::Light* lightComponent = light.Get())
+				lightComponent->SendLightValues(shader);
 		}
 	}
 
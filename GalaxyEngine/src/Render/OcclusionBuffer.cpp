@@ -0,0 +1,314 @@
+#include "pch.h"
+#include "Render/OcclusionBuffer.h"
+
+#include "Core/ThreadManager.h"
+
+#include "Utils/Simd.h"
+
+namespace GALAXY
+{
+	// Pixels written at once by the widest vector, the rows are padded to it
+	constexpr uint32_t rasterWidth = 8;
+	// Under this clip space w a point is considered on the eye
+	constexpr float minimumW = 1e-5f;
+
+	// Column major, the translation is in the last column
+	static Vec4f TransformPoint(const float* m, const Vec3f& point)
+	{
+		return Vec4f(m[0] * point.x + m[4] * point.y + m[8] * point.z + m[12],
+			m[1] * point.x + m[5] * point.y + m[9] * point.z + m[13],
+			m[2] * point.x + m[6] * point.y + m[10] * point.z + m[14],
+			m[3] * point.x + m[7] * point.y + m[11] * point.z + m[15]);
+	}
+
+	Render::OcclusionBuffer::OcclusionBuffer(const uint32_t width, const uint32_t height)
+		: m_width(std::max(width, 1u)), m_height(std::max(height, 1u))
+	{
+		m_stride = (m_width + rasterWidth - 1) / rasterWidth * rasterWidth;
+		m_tileCountX = (m_width + tileSize - 1) / tileSize;
+		m_tileCountY = (m_height + tileSize - 1) / tileSize;
+		m_bins.resize(m_tileCountX * m_tileCountY);
+		m_depth.assign(m_stride * m_height, 1.f);
+
+		uint32_t levelWidth = m_width;
+		uint32_t levelHeight = m_height;
+		while (levelWidth > 1 || levelHeight > 1)
+		{
+			levelWidth = (levelWidth + 1) / 2;
+			levelHeight = (levelHeight + 1) / 2;
+			Level& level = m_levels.emplace_back();
+			level.width = levelWidth;
+			level.height = levelHeight;
+			level.depth.assign(levelWidth * levelHeight, 1.f);
+		}
+	}
+
+	void Render::OcclusionBuffer::Begin(const Mat4& viewProjection)
+	{
+		m_viewProjection = viewProjection;
+		m_triangles.clear();
+		for (List<uint32_t>& bin : m_bins)
+		{
+			bin.clear();
+		}
+		std::fill(m_depth.begin(), m_depth.end(), 1.f);
+	}
+
+	void Render::OcclusionBuffer::AddOccluder(const Vec3f* positions, const size_t positionCount, const Mat4& modelMatrix)
+	{
+		const Mat4 modelViewProjection = m_viewProjection * modelMatrix;
+		const float* m = modelViewProjection.Data();
+		for (size_t i = 0; i + 2 < positionCount; i += 3)
+		{
+			Vec4f polygon[4];
+			Vec4f vertices[3];
+			float distances[3];
+			int insideCount = 0;
+			for (int j = 0; j < 3; j++)
+			{
+				vertices[j] = TransformPoint(m, positions[i + j]);
+				// Distance to the near plane, the part behind it is cut off
+				distances[j] = vertices[j].z + vertices[j].w;
+				insideCount += distances[j] >= 0.f;
+			}
+			if (insideCount == 0)
+				continue;
+			if (insideCount == 3)
+			{
+				AddTriangle(vertices[0], vertices[1], vertices[2]);
+				continue;
+			}
+
+			int polygonCount = 0;
+			for (int j = 0; j < 3; j++)
+			{
+				const int next = (j + 1) % 3;
+				if (distances[j] >= 0.f)
+					polygon[polygonCount++] = vertices[j];
+				if ((distances[j] >= 0.f) != (distances[next] >= 0.f))
+				{
+					const float t = distances[j] / (distances[j] - distances[next]);
+					const Vec4f& from = vertices[j];
+					const Vec4f& to = vertices[next];
+					polygon[polygonCount++] = Vec4f(from.x + (to.x - from.x) * t, from.y + (to.y - from.y) * t,
+						from.z + (to.z - from.z) * t, from.w + (to.w - from.w) * t);
+				}
+			}
+			for (int j = 2; j < polygonCount; j++)
+			{
+				AddTriangle(polygon[0], polygon[j - 1], polygon[j]);
+			}
+		}
+	}
+
+	void Render::OcclusionBuffer::AddTriangle(const Vec4f& a, const Vec4f& b, const Vec4f& c)
+	{
+		const Vec4f* clip[3] = { &a, &b, &c };
+		float x[3], y[3], z[3];
+		for (int i = 0; i < 3; i++)
+		{
+			const float w = std::max(clip[i]->w, minimumW);
+			// Rows start at the bottom like the normalized device coordinates
+			x[i] = (clip[i]->x / w * 0.5f + 0.5f) * static_cast<float>(m_width);
+			y[i] = (clip[i]->y / w * 0.5f + 0.5f) * static_cast<float>(m_height);
+			z[i] = clip[i]->z / w * 0.5f + 0.5f;
+		}
+
+		// Counter clockwise triangles face the camera, the others are culled like the renderer does
+		const float area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+		if (!(area > 0.f))
+			return;
+
+		// Pixels whose center can be in the triangle
+		Triangle triangle;
+		triangle.minX = std::max(static_cast<int>(std::ceil(std::min({ x[0], x[1], x[2] }) - 0.5f)), 0);
+		triangle.minY = std::max(static_cast<int>(std::ceil(std::min({ y[0], y[1], y[2] }) - 0.5f)), 0);
+		triangle.maxX = std::min(static_cast<int>(std::floor(std::max({ x[0], x[1], x[2] }) - 0.5f)), static_cast<int>(m_width) - 1);
+		triangle.maxY = std::min(static_cast<int>(std::floor(std::max({ y[0], y[1], y[2] }) - 0.5f)), static_cast<int>(m_height) - 1);
+		if (triangle.minX > triangle.maxX || triangle.minY > triangle.maxY)
+			return;
+
+		// Positive inside the triangle for each edge
+		for (int i = 0; i < 3; i++)
+		{
+			const int next = (i + 1) % 3;
+			triangle.edges[i][0] = y[i] - y[next];
+			triangle.edges[i][1] = x[next] - x[i];
+			triangle.edges[i][2] = x[i] * y[next] - x[next] * y[i];
+		}
+		// The depth after the perspective divide is linear on the screen
+		triangle.depth[0] = ((z[1] - z[0]) * (y[2] - y[0]) - (z[2] - z[0]) * (y[1] - y[0])) / area;
+		triangle.depth[1] = ((z[2] - z[0]) * (x[1] - x[0]) - (z[1] - z[0]) * (x[2] - x[0])) / area;
+		triangle.depth[2] = z[0] - triangle.depth[0] * x[0] - triangle.depth[1] * y[0];
+
+		const uint32_t index = static_cast<uint32_t>(m_triangles.size());
+		m_triangles.push_back(triangle);
+		for (int tileY = triangle.minY / static_cast<int>(tileSize); tileY <= triangle.maxY / static_cast<int>(tileSize); tileY++)
+		{
+			for (int tileX = triangle.minX / static_cast<int>(tileSize); tileX <= triangle.maxX / static_cast<int>(tileSize); tileX++)
+			{
+				m_bins[tileY * m_tileCountX + tileX].push_back(index);
+			}
+		}
+	}
+
+	void Render::OcclusionBuffer::End()
+	{
+		if (!m_triangles.empty())
+		{
+			Core::ThreadManager::GetInstance()->ParallelFor(m_bins.size(), [this](const size_t tile)
+				{
+					RasterizeTile(static_cast<uint32_t>(tile));
+				});
+		}
+		BuildHierarchy();
+	}
+
+	void Render::OcclusionBuffer::RasterizeTile(const uint32_t tile)
+	{
+		const int tileX = static_cast<int>(tile % m_tileCountX * tileSize);
+		const int tileY = static_cast<int>(tile / m_tileCountX * tileSize);
+		for (const uint32_t index : m_bins[tile])
+		{
+			const Triangle& triangle = m_triangles[index];
+			// The first column is aligned on the vectors, the tiles and the stride are multiples of their width
+			// so the lanes after the last column never reach the next tile
+			const int minX = std::max(triangle.minX, tileX) / static_cast<int>(rasterWidth) * static_cast<int>(rasterWidth);
+			const int maxX = std::min(triangle.maxX, tileX + static_cast<int>(tileSize) - 1);
+			const int minY = std::max(triangle.minY, tileY);
+			const int maxY = std::min(triangle.maxY, tileY + static_cast<int>(tileSize) - 1);
+			const float(&edges)[3][3] = triangle.edges;
+			const float(&depth)[3] = triangle.depth;
+
+			for (int y = minY; y <= maxY; y++)
+			{
+				const float centerY = static_cast<float>(y) + 0.5f;
+				float* row = m_depth.data() + y * m_stride;
+				int x = minX;
+#ifdef GALAXY_SIMD_AVX
+				const __m256 laneOffsets = _mm256_setr_ps(0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f);
+				for (; x <= maxX; x += 8)
+				{
+					const __m256 centerX = _mm256_add_ps(_mm256_set1_ps(static_cast<float>(x)), laneOffsets);
+					__m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+					for (const float(&edge)[3] : edges)
+					{
+						const __m256 value = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(edge[0]), centerX), _mm256_set1_ps(edge[1] * centerY + edge[2]));
+						inside = _mm256_and_ps(inside, _mm256_cmp_ps(value, _mm256_setzero_ps(), _CMP_GE_OQ));
+					}
+					if (_mm256_movemask_ps(inside) == 0)
+						continue;
+					const __m256 value = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(depth[0]), centerX), _mm256_set1_ps(depth[1] * centerY + depth[2]));
+					const __m256 previous = _mm256_loadu_ps(row + x);
+					_mm256_storeu_ps(row + x, _mm256_blendv_ps(previous, _mm256_min_ps(previous, value), inside));
+				}
+#elif defined(GALAXY_SIMD_SSE)
+				const __m128 laneOffsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+				for (; x <= maxX; x += 4)
+				{
+					const __m128 centerX = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), laneOffsets);
+					__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+					for (const float(&edge)[3] : edges)
+					{
+						const __m128 value = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(edge[0]), centerX), _mm_set1_ps(edge[1] * centerY + edge[2]));
+						inside = _mm_and_ps(inside, _mm_cmpge_ps(value, _mm_setzero_ps()));
+					}
+					if (_mm_movemask_ps(inside) == 0)
+						continue;
+					const __m128 value = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(depth[0]), centerX), _mm_set1_ps(depth[1] * centerY + depth[2]));
+					const __m128 previous = _mm_loadu_ps(row + x);
+					_mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(inside, _mm_min_ps(previous, value)), _mm_andnot_ps(inside, previous)));
+				}
+#else
+				for (; x <= maxX; x++)
+				{
+					const float centerX = static_cast<float>(x) + 0.5f;
+					if (edges[0][0] * centerX + edges[0][1] * centerY + edges[0][2] < 0.f
+						|| edges[1][0] * centerX + edges[1][1] * centerY + edges[1][2] < 0.f
+						|| edges[2][0] * centerX + edges[2][1] * centerY + edges[2][2] < 0.f)
+						continue;
+					row[x] = std::min(row[x], depth[0] * centerX + depth[1] * centerY + depth[2]);
+				}
+#endif
+			}
+		}
+	}
+
+	void Render::OcclusionBuffer::BuildHierarchy()
+	{
+		const float* source = m_depth.data();
+		uint32_t sourceWidth = m_width;
+		uint32_t sourceHeight = m_height;
+		uint32_t sourceStride = m_stride;
+		for (Level& level : m_levels)
+		{
+			// The last column and row of an odd source are read twice
+			for (uint32_t y = 0; y < level.height; y++)
+			{
+				const float* row0 = source + std::min(y * 2, sourceHeight - 1) * sourceStride;
+				const float* row1 = source + std::min(y * 2 + 1, sourceHeight - 1) * sourceStride;
+				for (uint32_t x = 0; x < level.width; x++)
+				{
+					const uint32_t x0 = std::min(x * 2, sourceWidth - 1);
+					const uint32_t x1 = std::min(x * 2 + 1, sourceWidth - 1);
+					level.depth[y * level.width + x] = std::max(std::max(row0[x0], row0[x1]), std::max(row1[x0], row1[x1]));
+				}
+			}
+			source = level.depth.data();
+			sourceWidth = level.width;
+			sourceHeight = level.height;
+			sourceStride = level.width;
+		}
+	}
+
+	bool Render::OcclusionBuffer::IsVisible(const Physic::AABB& bounds) const
+	{
+		if (m_triangles.empty())
+			return true;
+
+		const float* m = m_viewProjection.Data();
+		float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX;
+		float minDepth = FLT_MAX;
+		for (int corner = 0; corner < 8; corner++)
+		{
+			const Vec3f point(corner & 1 ? bounds.max.x : bounds.min.x, corner & 2 ? bounds.max.y : bounds.min.y, corner & 4 ? bounds.max.z : bounds.min.z);
+			const Vec4f clip = TransformPoint(m, point);
+			// A box crossing the near plane covers the whole view
+			if (clip.z + clip.w < 0.f || clip.w < minimumW)
+				return true;
+			const float x = (clip.x / clip.w * 0.5f + 0.5f) * static_cast<float>(m_width);
+			const float y = (clip.y / clip.w * 0.5f + 0.5f) * static_cast<float>(m_height);
+			minX = std::min(minX, x);
+			maxX = std::max(maxX, x);
+			minY = std::min(minY, y);
+			maxY = std::max(maxY, y);
+			minDepth = std::min(minDepth, clip.z / clip.w * 0.5f + 0.5f);
+		}
+
+		// Pixels touched by the screen rectangle of the box, the frustum culling decides for the boxes out of the view
+		const int x0 = std::max(static_cast<int>(std::floor(minX)), 0);
+		const int y0 = std::max(static_cast<int>(std::floor(minY)), 0);
+		const int x1 = std::min(static_cast<int>(std::floor(maxX)), static_cast<int>(m_width) - 1);
+		const int y1 = std::min(static_cast<int>(std::floor(maxY)), static_cast<int>(m_height) - 1);
+		if (x0 > x1 || y0 > y1)
+			return true;
+
+		// First level where the rectangle covers at most 2x2 values
+		uint32_t levelIndex = 0;
+		while ((x1 >> levelIndex) - (x0 >> levelIndex) > 1 || (y1 >> levelIndex) - (y0 >> levelIndex) > 1)
+		{
+			levelIndex++;
+		}
+		const float* depth = levelIndex == 0 ? m_depth.data() : m_levels[levelIndex - 1].depth.data();
+		const uint32_t stride = levelIndex == 0 ? m_stride : m_levels[levelIndex - 1].width;
+		for (int y = y0 >> levelIndex; y <= y1 >> levelIndex; y++)
+		{
+			for (int x = x0 >> levelIndex; x <= x1 >> levelIndex; x++)
+			{
+				if (depth[y * stride + x] >= minDepth)
+					return true;
+			}
+		}
+		return false;
+	}
+}
@@ -150,7 +150,7 @@ namespace GALAXY {
 		ImGui::PopID();
 	}
 
-	Weak<Resource::Shader> Resource::Material::SendValues(const uint64_t id /*= -1*/) const
+	Weak<Resource::Shader> Resource::Material::SendValues() const
 	{
 		auto renderer = Wrapper::Renderer::GetInstance();
 		const auto renderType = renderer->GetRenderType();
@@ -185,20 +185,6 @@ namespace GALAXY {
 			shader->SendVec4f("material.specular", m_specular);
 		}
 		break;
-		case Render::RenderType::Picking:
-		{
-			shader = m_shader.lock()->GetPickingVariant().lock();
-			if (!shader || !shader->HasBeenSent())
-				return {};
-			shader->Use();
-
-			const int r = (id & 0x000000FF) >> 0;
-			const int g = (id & 0x0000FF00) >> 8;
-			const int b = (id & 0x00FF0000) >> 16;
-
-			shader->SendVec4f("idColor", Vec4f(r / 255.f, g / 255.f, b / 255.f, 1.f));
-		}
-		break;
 		case Render::RenderType::Outline:
 		{
 			auto unlitShader = Resource::ResourceManager::GetInstance()->GetUnlitShader().lock();
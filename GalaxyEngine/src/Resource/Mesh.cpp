@@ -13,6 +13,8 @@
 
 #include "Wrapper/Renderer.h"
 
+#include "Utils/AffineMath.h"
+
 #include "Render/Camera.h"
 namespace GALAXY {
 
@@ -83,12 +85,12 @@ namespace GALAXY {
 		FinishLoading();
 	}
 
-	void Resource::Mesh::Render(const Mat4& modelMatrix, const std::vector<Weak<Resource::Material>>& materials, uint64_t id /*= -1*/) const
+	void Resource::Mesh::Render(const Mat4& modelMatrix, const std::vector<Weak<Resource::Material>>& materials) const
 	{
-		Render(modelMatrix, materials, nullptr, id);
+		Render(modelMatrix, materials, nullptr);
 	}
 	
-	void Resource::Mesh::Render(const Mat4& modelMatrix, const std::vector<Weak<class Material>>& materials, Resource::Scene* scene, uint64_t id /*= -1*/) const
+	void Resource::Mesh::Render(const Mat4& modelMatrix, const std::vector<Weak<class Material>>& materials, Resource::Scene* scene) const
 	{
 		if (!HasBeenSent() || !IsLoaded())
 			return;
@@ -100,15 +102,20 @@ namespace GALAXY {
 
 		const Vec3f viewPos = scene->GetCurrentCamera()->GetTransform()->GetLocalPosition();
 
+		// Normals use the inverse transpose of the model so non uniform scales keep them perpendicular to the surface
+		Mat4 normalMatrix;
+		Utils::AffineMath::ComputeNormalMatrix(modelMatrix, normalMatrix);
+
 		for (size_t i = 0; i < materials.size(); i++) {
 			if (!materials[i].lock() || i >= m_subMeshes.size())
 				continue;
-			auto shader = materials[i].lock()->SendValues(id).lock();
+			auto shader = materials[i].lock()->SendValues().lock();
 			if (shader == nullptr)
 				continue;
 
 			const Resource::Scene* currentScene = Core::SceneHolder::GetCurrentScene();
 			shader->SendMat4("Model", modelMatrix);
+			shader->SendMat4("NormalMatrix", normalMatrix);
 			shader->SendMat4("MVP", scene->GetVP() * modelMatrix);
 			shader->SendVec3f("ViewPos", viewPos);
 			shader->SendVec3f("CamUp", scene->GetCameraUp());
@@ -138,6 +145,18 @@ namespace GALAXY {
 		}
 	}
 
+	void Resource::Mesh::BuildTriangleBVH()
+	{
+		// The picking and the occlusion culling read the triangles after the vertices are released
+		constexpr size_t vertexSize = 11;
+		List<Vec3f> positions(m_finalVertices.size() / vertexSize);
+		for (size_t i = 0; i < positions.size(); i++)
+		{
+			positions[i] = Vec3f(m_finalVertices[i * vertexSize], m_finalVertices[i * vertexSize + 1], m_finalVertices[i * vertexSize + 2]);
+		}
+		m_triangleBVH.Build(std::move(positions));
+	}
+
 	void Resource::Mesh::DrawBoundingBox(const Component::Transform* transform) const
 	{
 		const BoundingBox box = GetBoundingBox();
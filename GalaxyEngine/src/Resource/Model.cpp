@@ -128,6 +128,7 @@ namespace GALAXY {
 
 	void Resource::Model::Unload()
 	{
+		m_meshLoadSubscriptions.clear();
 		for (auto& mesh : m_meshes)
 		{
 			Resource::ResourceManager::GetInstance()->RemoveResource(mesh.lock()->GetFileInfo().GetRelativePath());
@@ -136,11 +137,11 @@ namespace GALAXY {
 
 	Shared<Core::GameObject> Resource::Model::ToGameObject()
 	{
-		Shared<Core::GameObject> root = std::make_shared<Core::GameObject>(GetFileInfo().GetFileNameNoExtension());
+		Shared<Core::GameObject> root = Core::GameObject::Create(GetFileInfo().GetFileNameNoExtension());
 		size_t materialIndex = 0;
 		for (auto& mesh : m_meshes)
 		{
-			Shared<Core::GameObject> meshGO = std::make_shared<Core::GameObject>(mesh.lock()->GetMeshName());
+			Shared<Core::GameObject> meshGO = Core::GameObject::Create(mesh.lock()->GetMeshName());
 			auto meshComponent = meshGO->AddComponent<Component::MeshComponent>();
 			meshComponent.lock()->SetMesh(mesh);
 			for (auto& subMesh : mesh.lock()->m_subMeshes) {
@@ -25,14 +25,14 @@ namespace GALAXY
         Scene::Send();
     }
 
-    void Resource::Prefab::Save(const Path& fullPath) const
+    void Resource::Prefab::Save(const Path& fullPath)
     {
         Scene::Save(fullPath);
     }
 
     Weak<Core::GameObject> Resource::Prefab::Instantiate(Weak<Core::GameObject> parent)
     {
-        auto object = std::make_shared<Core::GameObject>(p_fileInfo.GetFileNameNoExtension());
+        auto object = Core::GameObject::Create(p_fileInfo.GetFileNameNoExtension());
         if (!p_loaded)
         {
             auto pair = std::make_pair(object, parent);
@@ -46,6 +46,31 @@ namespace GALAXY
         return object;
     }
 
+    List<Weak<Core::GameObject>> Resource::Prefab::InstantiateMany(const size_t count, const List<Core::GameObject::InstanceTransform>& transforms, Weak<Core::GameObject> parent)
+    {
+        if (!p_loaded)
+        {
+            PrintError("Prefab %s is not loaded", p_fileInfo.GetFileName().c_str());
+            return {};
+        }
+        PROFILE_SCOPE_LOG("Prefab::InstantiateMany(%zu)", count);
+
+        const List<Shared<Core::GameObject>> objects = m_root->CloneMany(count, transforms);
+
+        Shared<Core::GameObject> parentObject = parent.lock();
+        if (!parentObject)
+            parentObject = Core::SceneHolder::GetCurrentScene()->GetRootGameObject().lock();
+        parentObject->AddChildren(objects);
+
+        List<Weak<Core::GameObject>> instances(objects.begin(), objects.end());
+        for (const Shared<Core::GameObject>& object : objects)
+        {
+            object->FinishDeserialize();
+            object->AfterLoad();
+        }
+        return instances;
+    }
+
     void Resource::Prefab::CreateWith(const Path& fullPath, const std::shared_ptr<Core::GameObject>& gameObject)
     {
         auto prefab = Resource::ResourceManager::AddResource<Resource::Prefab>(fullPath).lock();
@@ -54,20 +79,18 @@ namespace GALAXY
         prefab->Save(fullPath);
     }
 
-    void DisplayGameObject(Shared<Core::GameObject> gameObject)
+    void DisplayGameObject(const Core::GameObject* gameObject)
     {
         if (ImGui::TreeNode(gameObject->GetName().c_str()))
         {
-            for (auto& child : gameObject->GetChildren())
-            {
-                DisplayGameObject(child.lock());
-            }
+            gameObject->ForEachChild(DisplayGameObject);
+            ImGui::TreePop();
         }
     }
 
     void Resource::Prefab::ShowInInspector()
     {
-        DisplayGameObject(m_root);
+        DisplayGameObject(m_root.get());
     }
 
     void Resource::Prefab::InstantiateInternal(Weak<Core::GameObject> parent, Shared<Core::GameObject> gameObject)
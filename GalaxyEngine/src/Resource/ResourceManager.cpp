@@ -124,6 +124,7 @@ namespace GALAXY {
 
 	void Resource::ResourceManager::LoadNeededResources()
 	{
+		std::lock_guard lock(m_resourceMutex);
 		for (auto& resource : m_resources)
 		{
 			auto type = resource.second->GetFileInfo().GetResourceType();
@@ -276,6 +277,7 @@ namespace GALAXY {
 
 	inline Weak<Resource::IResource> Resource::ResourceManager::ReloadResource(const Path& fullPath)
 	{
+		std::lock_guard lock(m_instance->m_resourceMutex);
 		const Path relativePath = Utils::FileInfo::ToRelativePath(fullPath);
 		if (!m_instance->m_resources.contains(relativePath)) {
 			//PrintWarning("Resource %s not found in Resource Manager, Create it", relativePath.string().c_str());
@@ -293,6 +295,7 @@ namespace GALAXY {
 
 	Weak<Resource::IResource> Resource::ResourceManager::GetResource(const Core::UUID& uuid)
 	{
+		std::lock_guard lock(m_instance->m_resourceMutex);
 		if (uuid == UUID_NULL)
 			return {};
 		auto resource = std::ranges::find_if(m_instance->m_resources, [&](const std::pair<Path, Shared<IResource>>& _resource)
@@ -348,6 +351,8 @@ namespace GALAXY {
 		std::set<Path> newFiles;
 		auto map = parser.GetValueMap()[0];
 
+		std::lock_guard lock(m_resourceMutex);
+
 		for (auto& resource : m_resources)
 		{
 			if (resource.second->GetFileInfo().GetResourceDir() == ResourceDir::Editor || !std::filesystem::exists(resource.second->GetFileInfo().GetFullPath()))
@@ -403,6 +408,7 @@ namespace GALAXY {
 
 		CppSer::Serializer serializer(cachePath / "resource.cache");
 		serializer << CppSer::Pair::BeginMap << "Resources";
+		std::lock_guard lock(m_resourceMutex);
 		for (auto& val : m_resources | std::views::values)
 		{
 			if (val->GetFileInfo().GetResourceDir() == ResourceDir::Editor || !std::filesystem::exists(val->GetFileInfo().GetFullPath()))
@@ -431,6 +437,7 @@ namespace GALAXY {
 		Path relativeNew = Utils::FileInfo::ToRelativePath(newPath);
 		std::set<Path> resourceKeys;
 
+		std::lock_guard lock(m_instance->m_resourceMutex);
 		for (auto& resource : m_instance->m_resources)
 		{
 			if (!resource.second || resource.second->GetFileInfo().GetResourceDir() == ResourceDir::Editor)
@@ -474,6 +481,7 @@ namespace GALAXY {
 	void Resource::ResourceManager::RenameSingle(const Path& oldPath, const Path& newPath)
 	{
 		auto relativeOld = Utils::FileInfo::ToRelativePath(oldPath);
+		std::lock_guard lock(m_instance->m_resourceMutex);
 		auto it = m_instance->m_resources.find(relativeOld);
 		ASSERT(it != m_instance->m_resources.end());
 
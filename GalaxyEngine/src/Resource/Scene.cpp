@@ -19,17 +19,36 @@
 #endif
 
 #include "Component/CameraComponent.h"
+#include "Component/Emitter.h"
+#include "Component/Listener.h"
+#include "Component/MeshComponent.h"
+#include "Component/Light.h"
 
 #include "Wrapper/Window.h"
 
 #include "Core/Input.h"
+#include "Core/ThreadManager.h"
+#include "Core/TickRegistry.h"
+#include "Core/SystemScheduler.h"
+#include "Core/CommandBuffer.h"
+#include "Core/BoundsRegistry.h"
+
+#include "Utils/FileSystem.h"
+#include "Utils/Arena.h"
+
+#include <unordered_set>
 
 using namespace Resource;
 namespace GALAXY
 {
 	Scene::Scene(const Path& path) : IResource(path)
 	{
-		m_root = std::make_shared<Core::GameObject>(GetFileInfo().GetFileNameNoExtension());
+		m_transformHierarchy = std::make_shared<Core::TransformHierarchy>();
+		m_tickRegistry = std::make_shared<Core::TickRegistry>();
+		m_commandBuffer = std::make_shared<Core::CommandBuffer>();
+		m_frameArena = std::make_shared<Utils::Arena>();
+		m_boundsRegistry = std::make_shared<Core::BoundsRegistry>();
+		m_root = Core::GameObject::Create(GetFileInfo().GetFileNameNoExtension());
 		m_root->m_scene = this;
 	}
 
@@ -45,31 +64,212 @@ namespace GALAXY
 		m_actionManager = std::make_shared<Editor::ActionManager>();
 #endif
 		m_lightManager = std::make_shared<Render::LightManager>();
+		InitializeSystems();
 	}
 
+	void Scene::InitializeSystems()
+	{
+		// Created here and not in the constructor, the systems keep a pointer to this scene
+		m_systemScheduler = std::make_shared<Core::SystemScheduler>();
+
+		m_systemScheduler->AddSystem("Transform", [this]()
+			{
+				m_transformHierarchy->Update(m_root.get());
+			}).Write<Component::Transform>();
+
+		// Stores the slots of the meshes in them, registers the handles of the meshes and their objects,
+		// and moves the proxies of the spatial index owned by the registry
+		m_systemScheduler->AddSystem("Bounds", [this]()
+			{
+				m_boundsRegistry->Update(this);
+			}).Read<Component::Transform>().Write<Component::MeshComponent>().Write<Core::GameObject>().Write<Core::BoundsRegistry>();
+
+		m_systemScheduler->AddSystem("Audio", [this]()
+			{
+				Component::ComponentPool<Component::Emitter>::ForEach([this](Component::Emitter* emitter)
+					{
+						if (emitter->GetGameObject() && emitter->GetGameObject()->GetScene() == this && emitter->IsEnable() && emitter->GetTransform()->WasDirty())
+							emitter->OnTransformUpdate();
+					});
+				Component::ComponentPool<Component::Listener>::ForEach([this](Component::Listener* listener)
+					{
+						if (listener->GetGameObject() && listener->GetGameObject()->GetScene() == this && listener->IsEnable() && listener->GetTransform()->WasDirty())
+							listener->OnTransformUpdate();
+					});
+			}).Read<Component::Transform>().Write<Component::Emitter>().Write<Component::Listener>();
+
+		// Events and scripts can access anything
+		m_systemScheduler->AddSystem("Transform Events", [this]()
+			{
+				m_transformHierarchy->InvokeUpdateEvents();
+			}).WriteAll().MainThread();
+
+		m_systemScheduler->AddSystem("Update", [this]()
+			{
+				m_tickRegistry->ForEach(Component::TickFlag::Update, [](Component::BaseComponent* component)
+					{
+						component->OnUpdate();
+					});
+			}).WriteAll().MainThread();
+
+		m_systemScheduler->AddSystem("Editor Update", [this]()
+			{
+				m_tickRegistry->ForEach(Component::TickFlag::EditorUpdate, [](Component::BaseComponent* component)
+					{
+						component->OnEditorUpdate();
+					});
+			}).WriteAll().MainThread();
+
+		// Sync point of the structural changes recorded during the frame
+		m_systemScheduler->AddSystem("Structural Changes", [this]()
+			{
+				m_commandBuffer->Execute(this);
+			}).WriteAll().MainThread();
+	}
+
+	Physic::DynamicBVH* Scene::GetSpatialIndex() const
+	{
+		return m_boundsRegistry->GetSpatialIndex();
+	}
+
+#ifdef WITH_EDITOR
+	Shared<Core::GameObject> Scene::Pick(const Physic::Ray& ray, float* distance) const
+	{
+		Core::GameObject* picked = nullptr;
+		Core::BoundsRegistry::RaycastHit hit;
+		float closestDistance = ray.scale;
+		if (m_boundsRegistry->Raycast(ray, hit))
+		{
+			picked = hit.component->GetGameObject();
+			closestDistance = hit.distance;
+		}
+
+		// The icons are drawn over the meshes of the editor only, they are few
+		auto pickIcon = [&](const auto* component)
+			{
+				float iconDistance;
+				if (component->GetGameObject() && component->GetGameObject()->GetScene() == this && component->IsEnable()
+					&& component->GetEditorIcon().Raycast(ray, m_cameraUp, m_cameraRight, iconDistance) && iconDistance < closestDistance)
+				{
+					closestDistance = iconDistance;
+					picked = component->GetGameObject();
+				}
+			};
+		Component::ComponentPool<Component::CameraComponent>::ForEach([&](const Component::CameraComponent* camera) { pickIcon(camera); });
+		Component::ComponentPool<Component::Light>::ForEach([&](const Component::Light* light) { pickIcon(light); });
+
+		if (!picked)
+			return nullptr;
+		if (distance)
+			*distance = closestDistance;
+		return picked->shared_from_this();
+	}
+#endif
+
 	bool Scene::WasModified() const
 	{
-		// Compare current scene to last saved
-		auto file = std::fstream(p_fileInfo.GetFullPath(), std::ios::in);
-		if (!file.is_open()) {
-			file.close();
+		if (!std::filesystem::exists(p_fileInfo.GetFullPath()))
 			return true;
+		return m_generation != m_savedGeneration;
+	}
+
+	void Scene::MarkModified(Core::GameObject* object)
+	{
+		m_generation++;
+		if (object->m_modified)
+			return;
+		// Objects being destroyed are already reported through their parent
+		const Weak<Core::GameObject> weakObject = object->weak_from_this();
+		if (weakObject.expired())
+			return;
+		object->m_modified = true;
+		m_modifiedObjects[object->GetUUID()] = weakObject;
+	}
+
+	void Scene::OnSceneGraphIDChanged(Core::GameObject* object, const uint64_t previousID)
+	{
+		if (previousID != object->m_sceneGraphID)
+		{
+			const auto previousEntry = m_sceneGraphIndex.find(previousID);
+			if (previousEntry != m_sceneGraphIndex.end() && previousEntry->second.lock().get() == object)
+				m_sceneGraphIndex.erase(previousEntry);
 		}
-		const std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+		Weak<Core::GameObject>& entry = m_sceneGraphIndex[object->m_sceneGraphID];
+		if (entry.lock().get() != object)
+			entry = object->weak_from_this();
+	}
 
-		CppSer::Serializer serializer(p_fileInfo.GetFullPath());
-		serializer.SetShouldSaveOnDestroy(false);
-		m_root->Serialize(serializer);
+	void Scene::AddObjects(const List<Shared<Core::GameObject>>& objects)
+	{
+		// Flatten the hierarchies first so the object list is resized once
+		List<Core::GameObject*> flattened;
+		for (const Shared<Core::GameObject>& object : objects)
+			flattened.push_back(object.get());
+		for (size_t i = 0; i < flattened.size(); i++)
+		{
+			for (const Shared<Core::GameObject>& child : flattened[i]->m_children)
+				flattened.push_back(child.get());
+		}
+
+		m_objectList.reserve(m_objectList.size() + flattened.size());
+		for (Core::GameObject* object : flattened)
+		{
+			if (!m_objectList.try_emplace(object->m_UUID, object->shared_from_this()).second)
+			{
+				ASSERT(false);
+			}
+		}
+		for (const Shared<Core::GameObject>& object : objects)
+		{
+			object->SetScene(this);
+		}
+	}
+
+	void Scene::DestroyObjects(const List<Shared<Core::GameObject>>& objects)
+	{
+		// Remove the objects from their parents, one pass over the children of each parent
+		using Allocator = Utils::ArenaAllocator<const Core::GameObject*>;
+		const Allocator allocator(*m_frameArena);
+		std::unordered_set<const Core::GameObject*, std::hash<const Core::GameObject*>, std::equal_to<>, Allocator> destroyed(allocator);
+		std::unordered_set<Shared<Core::GameObject>, std::hash<Shared<Core::GameObject>>, std::equal_to<>, Utils::ArenaAllocator<Shared<Core::GameObject>>> parents(allocator);
+		for (const Shared<Core::GameObject>& object : objects)
+		{
+			destroyed.insert(object.get());
+			if (Shared<Core::GameObject> parent = object->GetParent())
+				parents.insert(std::move(parent));
+		}
+		for (const Shared<Core::GameObject>& parent : parents)
+		{
+			if (std::erase_if(parent->m_children, [&](const Shared<Core::GameObject>& child) { return destroyed.contains(child.get()); }) == 0)
+				continue;
+			parent->UpdateChildIndices();
+			parent->OnChildrenChanged();
+		}
 
-		const std::string newContent = serializer.GetContent();
+		for (const Shared<Core::GameObject>& object : objects)
+		{
+			RemoveObject(object.get());
+			object->ClearTickRegistration();
+		}
+	}
 
-		return content != newContent;
+	void Scene::ClearModified(const uint64_t savedGeneration)
+	{
+		m_savedGeneration = savedGeneration;
+		// Objects modified after the saved generation stay in the list
+		if (savedGeneration != m_generation)
+			return;
+		for (const Weak<Core::GameObject>& object : m_modifiedObjects | std::views::values)
+		{
+			if (const Shared<Core::GameObject> lockedObject = object.lock())
+				lockedObject->m_modified = false;
+		}
+		m_modifiedObjects.clear();
 	}
 
 	void Scene::Update()
 	{
 		Wrapper::Renderer* renderer = Wrapper::Renderer::GetInstance();
-		Wrapper::Window* window = Core::Application::GetInstance().GetWindow();
 #ifdef WITH_EDITOR
 		Editor::UI::Inspector* inspector = Editor::UI::EditorUIManager::GetInstance()->GetInspector();
 		Editor::UI::SceneWindow* sceneWindow = Editor::UI::EditorUIManager::GetInstance()->GetSceneWindow();
@@ -83,7 +283,11 @@ namespace GALAXY
 		if (!HasBeenSent()) // if it reload the current scene from the Main Bar menu
 			return;
 
-		m_root->UpdateSelfAndChild();
+		UpdatePendingSave();
+
+		m_frameArena->Reset();
+		m_systemScheduler->Run();
+		CullCameras();
 
 #ifdef WITH_EDITOR
 		m_actionManager->Update();
@@ -130,34 +334,16 @@ namespace GALAXY
 			static Vec3f clickPosition = Vec3f::Zero();
 			if (Input::IsMouseButtonPressed(MouseButton::BUTTON_1) && sceneWindow->IsHovered())
 			{
-				renderer->ClearColorAndBuffer(Vec4f(1));
-
-				renderer->SetRenderingType(Render::RenderType::Picking);
-				m_root->DrawSelfAndChild(DrawMode::Editor);
-				renderer->SetRenderingType(Render::RenderType::Default);
-
-				// Calculate Mouse Position
-				const Vec2f mainWindowSize = window->GetSize();
-				const Vec2f imageSize = sceneWindow->GetImageSize();
-				Vec2f mousePosition = sceneWindow->GetMousePosition();
-				mousePosition = mousePosition * Vec2f(mainWindowSize.x / imageSize.x, mainWindowSize.y / imageSize.y);
-				mousePosition.y = mainWindowSize.y - mousePosition.y;
-
-				const Vec4f color = renderer->ReadPixelColor(mousePosition);
-
-				const auto pickedID = static_cast<uint64_t>(color.x + color.y * 256 + color.z * 256 * 256);
-
+				// Picked on the CPU through the triangle trees of the meshes, the GPU is never waited for
+				const Physic::Ray ray = m_editorCamera->ScreenPointToRay(sceneWindow->GetMousePosition());
 				if (m_gizmo->IsGizmoClicked())
 				{
 				}
-				else if (const Shared<Core::GameObject> gameObject = GetWithSceneGraphID(pickedID).lock())
+				else if (const Shared<Core::GameObject> gameObject = Pick(ray))
 					inspector->SetSelected(gameObject);
 				else
 					inspector->ClearSelected();
 
-				renderer->ClearColorAndBuffer(currentCamera->GetClearColor());
-
-				const Physic::Ray ray = m_editorCamera->ScreenPointToRay(sceneWindow->GetMousePosition());
 				cameraPosition = ray.origin;
 				clickPosition = ray.origin + ray.direction * ray.scale;
 			}
@@ -169,7 +355,7 @@ namespace GALAXY
 			if (*Core::Application::GetInstance().GetDrawGridPtr())
 				m_grid->Draw();
 
-			m_root->DrawSelfAndChild(DrawMode::Editor);
+			DrawComponents(DrawMode::Editor);
 			m_gizmo->Draw();
 
 			currentCamera->End();
@@ -197,19 +383,73 @@ namespace GALAXY
 
 			m_lightManager->SendLightData();
 
-			m_root->DrawSelfAndChild(DrawMode::Game);
+			DrawComponents(DrawMode::Game);
 
 			currentCamera->End();
 		}
 	}
 
+	void Scene::DrawComponents(const DrawMode drawMode) const
+	{
+		m_tickRegistry->ForEach(Component::TickFlag::Draw, [drawMode](Component::BaseComponent* component)
+			{
+				switch (drawMode)
+				{
+				case DrawMode::Editor:
+					component->OnEditorDraw();
+					break;
+				case DrawMode::Game:
+					component->OnGameDraw();
+					break;
+				default:
+					break;
+				}
+				component->OnDraw();
+			});
+	}
+
 	void Scene::SetCurrentCamera(const Weak<Render::Camera>& camera)
 	{
 		m_currentCamera = camera;
-		m_currentCamera.lock()->CreateFrustum();
-		m_VP = m_currentCamera.lock()->GetViewProjectionMatrix();
-		m_cameraUp = m_currentCamera.lock()->GetTransform()->GetUp();
-		m_cameraRight = m_currentCamera.lock()->GetTransform()->GetRight();
+		const Shared<Render::Camera> currentCamera = camera.lock();
+		currentCamera->CreateFrustum();
+		m_VP = currentCamera->GetViewProjectionMatrix();
+		// A camera missing from the cull of the frame, like the one of a thumbnail, is culled as one more view
+		// so the results of the other cameras are kept
+		const auto culledCamera = std::find(m_culledCameras.begin(), m_culledCameras.end(), currentCamera.get());
+		if (culledCamera != m_culledCameras.end())
+			m_boundsRegistry->SetCurrentView(static_cast<uint32_t>(culledCamera - m_culledCameras.begin()));
+		else
+		{
+			if (m_boundsRegistry->AddView({ currentCamera->GetFrustum(), m_VP, &currentCamera->GetCullCache() }) == 0)
+				m_culledCameras.clear();
+			m_culledCameras.push_back(currentCamera.get());
+		}
+		m_cameraUp = currentCamera->GetTransform()->GetUp();
+		m_cameraRight = currentCamera->GetTransform()->GetRight();
+	}
+
+	void Scene::CullCameras()
+	{
+		List<Core::BoundsRegistry::CullView> views;
+		m_culledCameras.clear();
+		auto addCamera = [&](Render::Camera* camera)
+			{
+				if (!camera->IsVisible() || views.size() == Core::BoundsRegistry::maxCullViews)
+					return;
+				camera->CreateFrustum();
+				views.push_back({ camera->GetFrustum(), camera->GetViewProjectionMatrix(), &camera->GetCullCache() });
+				m_culledCameras.push_back(camera);
+			};
+#ifdef WITH_EDITOR
+		addCamera(m_editorCamera.get());
+#endif
+		for (const Weak<Component::CameraComponent>& camera : m_cameras)
+		{
+			if (const Shared<Component::CameraComponent> cameraComponent = camera.lock())
+				addCamera(cameraComponent.get());
+		}
+		m_boundsRegistry->CullViews(views);
 	}
 
 #pragma region Resource Methods
@@ -219,6 +459,53 @@ namespace GALAXY
 		Unload();
 	}
 
+	// Split the scene file between the root object text and the text of each top level object with its children.
+	// The blocks are followed by their depth, return false if they are not balanced
+	bool SplitSceneContent(const String& content, String& rootContent, List<String>& subtrees)
+	{
+		constexpr std::string_view beginBlock = "------------- BEGIN";
+		constexpr std::string_view endBlock = "============= END";
+		constexpr std::string_view beginObject = "------------- BEGIN GAMEOBJECT";
+
+		// The root object is at depth 1, the top level objects open at depth 1 and close back to it
+		size_t depth = 0;
+		size_t subtreeBegin = String::npos;
+		size_t lineBegin = 0;
+		while (lineBegin < content.size())
+		{
+			size_t lineEnd = content.find('\n', lineBegin);
+			lineEnd = lineEnd == String::npos ? content.size() : lineEnd + 1;
+			const std::string_view line(content.data() + lineBegin, lineEnd - lineBegin);
+			const size_t textBegin = line.find_first_not_of(" \t");
+			const std::string_view text = textBegin == std::string_view::npos ? std::string_view() : line.substr(textBegin);
+
+			if (text.starts_with(beginBlock))
+			{
+				if (depth == 1 && subtreeBegin == String::npos && text.starts_with(beginObject))
+					subtreeBegin = lineBegin;
+				depth++;
+			}
+			else if (text.starts_with(endBlock))
+			{
+				if (depth == 0)
+					return false;
+				depth--;
+				if (depth == 1 && subtreeBegin != String::npos)
+				{
+					subtrees.emplace_back(content, subtreeBegin, lineEnd - subtreeBegin);
+					subtreeBegin = String::npos;
+					lineBegin = lineEnd;
+					continue;
+				}
+			}
+
+			if (subtreeBegin == String::npos)
+				rootContent.append(line);
+			lineBegin = lineEnd;
+		}
+		return depth == 0;
+	}
+
 	void Resource::Scene::Load()
 	{
 		if (p_shouldBeLoaded)
@@ -227,10 +514,45 @@ namespace GALAXY
 		{
 			const Path& path = GetFileInfo().GetFullPath();
 			PROFILE_SCOPE_LOG("Scene::Load(%s)", path.generic_string().c_str());
-			CppSer::Parser parser(path);
+
+			const String content = Utils::FileSystem::ReadFile(path);
+			String rootContent;
+			List<String> subtrees;
+			const bool split = SplitSceneContent(content, rootContent, subtrees);
+			CppSer::Parser parser(rootContent);
 			m_root->m_scene = this;
-			m_root->Deserialize(parser);
+
+			// A file whose top level objects do not match the root child number is loaded serially
+			if (!split || parser["Child Number"].As<size_t>() != subtrees.size())
+			{
+				PrintWarning("Scene %s could not be split between its top level objects, loading it serially", path.generic_string().c_str());
+				CppSer::Parser contentParser(content);
+				m_root->Deserialize(contentParser);
+			}
+			else
+			{
+				// Build the top level objects with their children in parallel, without any access to the scene
+				List<Shared<Core::GameObject>> objects(subtrees.size());
+				Core::ThreadManager::GetInstance()->ParallelFor(subtrees.size(), [&](const size_t index)
+					{
+						CppSer::Parser subtreeParser(subtrees[index]);
+						objects[index] = Core::GameObject::Create();
+						objects[index]->DeserializeDetached(subtreeParser);
+					});
+
+				// Link and register the objects in the file order
+				m_root->DeserializeHead(parser, true);
+				m_root->m_children = std::move(objects);
+				m_root->UpdateChildIndices();
+				m_root->FinishDeserialize();
+				for (const Shared<Core::GameObject>& child : m_root->m_children)
+				{
+					AddObject(child);
+				}
+			}
+			m_transformHierarchy->SetStructureDirty();
 		}
+		ClearModified();
 
 		p_loaded = true;
 		SendRequest();
@@ -238,9 +560,17 @@ namespace GALAXY
 
 	void Scene::SetMainCamera(const Weak<Component::CameraComponent>& camera)
 	{
-		if (m_mainCamera.lock())
-			m_mainCamera.lock()->m_isMainCamera = false;
-		camera.lock()->m_isMainCamera = true;
+		const Shared<Component::CameraComponent> previousCamera = m_mainCamera.lock();
+		const Shared<Component::CameraComponent> newCamera = camera.lock();
+		if (previousCamera == newCamera && newCamera->m_isMainCamera)
+			return;
+		if (previousCamera)
+		{
+			previousCamera->m_isMainCamera = false;
+			previousCamera->SetModified();
+		}
+		newCamera->m_isMainCamera = true;
+		newCamera->SetModified();
 		m_mainCamera = camera;
 	}
 
@@ -271,6 +601,13 @@ namespace GALAXY
 
 	void Scene::Unload()
 	{
+		// The pending save still holds copies of the objects, they are released on the main thread
+		if (m_pendingSave)
+		{
+			m_queuedSavePath.reset();
+			m_pendingSave->result.wait();
+			UpdatePendingSave();
+		}
 		if (m_root)
 		{
 			m_root->Destroy();
@@ -282,21 +619,129 @@ namespace GALAXY
 	{
 		m_root->AfterLoad();
 		Initialize();
+		ClearModified();
+	}
+
+	void SceneSnapshot::WriteCopies()
+	{
+		for (Core::GameObject::SerializedCopy& copy : copies)
+		{
+			Core::GameObject::WriteSerializedCopy(copy);
+			chunks[copy.headChunk] = copy.head;
+			chunks[copy.footerChunk] = copy.footer;
+		}
+	}
+
+	String SceneSnapshot::GetContent() const
+	{
+		size_t size = 0;
+		for (const Shared<const String>& chunk : chunks)
+			size += chunk->size();
+
+		String content;
+		content.reserve(size);
+		for (const Shared<const String>& chunk : chunks)
+			content += *chunk;
+		return content;
 	}
 
-	void Scene::Save(const Path& fullPath) const
+	Shared<SceneSnapshot> Scene::CreateSnapshot(const Path& fullPath)
 	{
-		CppSer::Serializer serializer(fullPath.empty() ? p_fileInfo.GetFullPath() : fullPath);
+		PROFILE_SCOPE_LOG("Scene Snapshot");
+		Shared<SceneSnapshot> snapshot = std::make_shared<SceneSnapshot>();
+		snapshot->path = fullPath.empty() ? p_fileInfo.GetFullPath() : fullPath;
+		snapshot->generation = m_generation;
+
+		// Only the objects modified since their last serialization are copied, the others give their cached text
+		snapshot->chunks.reserve(m_lastSnapshotSize);
+		m_root->GetSerializedChunks(snapshot->chunks, snapshot->copies);
+		m_lastSnapshotSize = snapshot->chunks.size();
+		return snapshot;
+	}
+
+	void Scene::Save(const Path& fullPath)
+	{
+		if (!m_root)
+			return;
 
+		// Wait for the background save so both do not write the same file
+		m_queuedSavePath.reset();
+		if (m_pendingSave)
+			m_pendingSave->result.wait();
+		UpdatePendingSave();
+
+		const Shared<SceneSnapshot> snapshot = CreateSnapshot(fullPath);
+		snapshot->WriteCopies();
+		OnSaveFinished(*snapshot, Utils::FileSystem::WriteFileAtomic(snapshot->path, snapshot->GetContent()));
+	}
+
+	void Scene::SaveAsync(const Path& fullPath)
+	{
 		if (!m_root)
 			return;
-		m_root->Serialize(serializer);
-		serializer.CloseFile();
+
+		if (m_pendingSave)
+		{
+			m_queuedSavePath = fullPath;
+			return;
+		}
+
+		m_pendingSave = std::make_shared<PendingSave>();
+		m_pendingSave->snapshot = CreateSnapshot(fullPath);
+
+#ifdef ENABLE_MULTI_THREAD
+		// The task only owns the snapshot, the scene waits for it before being unloaded
+		Core::ThreadManager::GetInstance()->AddTask([pendingSave = m_pendingSave]()
+			{
+				pendingSave->snapshot->WriteCopies();
+				pendingSave->success.set_value(Utils::FileSystem::WriteFileAtomic(pendingSave->snapshot->path, pendingSave->snapshot->GetContent()));
+			});
+#else
+		m_pendingSave->snapshot->WriteCopies();
+		m_pendingSave->success.set_value(Utils::FileSystem::WriteFileAtomic(m_pendingSave->snapshot->path, m_pendingSave->snapshot->GetContent()));
+#endif
+	}
+
+	void Scene::UpdatePendingSave()
+	{
+		if (!m_pendingSave || m_pendingSave->result.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+			return;
+
+		const Shared<PendingSave> pendingSave = std::move(m_pendingSave);
+		OnSaveFinished(*pendingSave->snapshot, pendingSave->result.get());
+
+		if (m_queuedSavePath.has_value())
+		{
+			const Path path = m_queuedSavePath.value();
+			m_queuedSavePath.reset();
+			SaveAsync(path);
+		}
+	}
+
+	void Scene::OnSaveFinished(SceneSnapshot& snapshot, const bool success)
+	{
+		// The text is reused by the next saves whether this one was written or not
+		for (const Core::GameObject::SerializedCopy& copy : snapshot.copies)
+		{
+			Core::GameObject::CacheSerializedCopy(copy);
+		}
+		// The cloned components are destroyed here, on the main thread
+		snapshot.copies.clear();
+
+		if (!success)
+		{
+			PrintError("Failed to save scene %s", snapshot.path.string().c_str());
+			return;
+		}
+		PrintLog("Scene saved : %s", snapshot.path.string().c_str());
+
+		if (snapshot.path == p_fileInfo.GetFullPath())
+			ClearModified(snapshot.generation);
 	}
 
 	Weak<Scene> Scene::Create(const Path& path)
 	{
-		const Scene scene(path);
+		Scene scene(path);
 		scene.Save();
 		return ResourceManager::GetInstance()->GetOrLoad<Scene>(path);
 	}
@@ -255,7 +255,7 @@ void main()
 		}
 	}
 
-	void Resource::Shader::SetVertex(const Shared<VertexShader>& vertexShader, const Weak<Shader>& weak_this, bool createVariant /*= true*/)
+	void Resource::Shader::SetVertex(const Shared<VertexShader>& vertexShader, const Weak<Shader>& weak_this)
 	{
 		Shared<BaseShader> shader = std::get<0>(p_subShaders).lock();
 		if (shader)
@@ -264,15 +264,6 @@ void main()
 		std::get<0>(p_subShaders) = vertexShader;
 		if (vertexShader)
 			vertexShader->AddShader(weak_this);
-
-		if (!createVariant)
-			return;
-		m_pickingVariant = Create(vertexShader->GetFileInfo().GetFullPath(), PICKING_PATH);
-		if (m_pickingVariant)
-		{
-			m_pickingVariant->SetDisplayOnInspector(false);
-			m_pickingVariant->SetCreateDataFile(false);
-		}
 	}
 
 	void Resource::Shader::SetGeometry(const Shared<GeometryShader>& geometryShader, const Weak<Shader>& weak_this)
@@ -334,7 +325,7 @@ void main()
 		auto shader = ResourceManager::TemporaryAdd<Shader>(shaderPath);
 		shader->p_isAVariant = true;
 		shader->SetFragment(fragShader.lock(), shader);
-		shader->SetVertex(vertexShader.lock(), shader, false);
+		shader->SetVertex(vertexShader.lock(), shader);
 
 		shader = ResourceManager::TemporaryLoad<Shader>(shaderPath);
 		return shader;
@@ -134,15 +134,7 @@ namespace GALAXY
 		do
 		{
 			std::string scriptName = parser["EDITOR ScriptName"].As<std::string>();
-			Shared<Component::BaseComponent> instanceScriptComponent = nullptr;
-			for (const auto& instanceComponent : Component::ComponentHolder::GetList())
-			{
-				if (instanceComponent->GetComponentName() == scriptName)
-				{
-					instanceScriptComponent = instanceComponent;
-					break;
-				}
-			}
+			Shared<Component::BaseComponent> instanceScriptComponent = Component::ComponentHolder::GetWithName(scriptName);
 
 			if (!instanceScriptComponent)
 			{
@@ -103,11 +103,8 @@ namespace GALAXY
 		if (variableTypeMap.contains(typeName))
 			return variableTypeMap[typeName];
 
-		for (auto& instanceComponent : Component::ComponentHolder::GetList())
-		{
-			if (instanceComponent->GetComponentName() == typeName)
-				return VariableType::Component;
-		}
+		if (Component::ComponentHolder::GetWithName(typeName))
+			return VariableType::Component;
 
 		return VariableType::Unknown;
 	}
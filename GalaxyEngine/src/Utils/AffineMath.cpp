@@ -0,0 +1,313 @@
+#include "pch.h"
+#include "Utils/AffineMath.h"
+
+#include "Utils/Simd.h"
+
+// Mat4 memory is column major : column c, row r is at Data()[c * 4 + r]
+namespace GALAXY {
+	// Matrix of one transform of the block, also used for the lanes left by the vector loops
+	static void ComposeTRSScalar(const Utils::AffineMath::TRSBlock& block, const size_t index, float* out)
+	{
+		const float x = block.rotation[0][index], y = block.rotation[1][index], z = block.rotation[2][index], w = block.rotation[3][index];
+		const float sx = block.scale[0][index], sy = block.scale[1][index], sz = block.scale[2][index];
+		const float lengthSquared = x * x + y * y + z * z + w * w;
+		const float two = lengthSquared != 0.f ? 2.f / lengthSquared : 0.f;
+
+		out[0] = (1.f - two * (y * y + z * z)) * sx;
+		out[1] = two * (x * y + w * z) * sx;
+		out[2] = two * (x * z - w * y) * sx;
+		out[3] = 0.f;
+
+		out[4] = two * (x * y - w * z) * sy;
+		out[5] = (1.f - two * (x * x + z * z)) * sy;
+		out[6] = two * (y * z + w * x) * sy;
+		out[7] = 0.f;
+
+		out[8] = two * (x * z + w * y) * sz;
+		out[9] = two * (y * z - w * x) * sz;
+		out[10] = (1.f - two * (x * x + y * y)) * sz;
+		out[11] = 0.f;
+
+		out[12] = block.position[0][index];
+		out[13] = block.position[1][index];
+		out[14] = block.position[2][index];
+		out[15] = 1.f;
+	}
+
+#ifdef GALAXY_SIMD_SSE
+	// Columns of 4 transforms stored one component per register, transposed to write one matrix per transform
+	static void StoreColumns(const __m128 (&columns)[4][3], Mat4* result)
+	{
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 one = _mm_set1_ps(1.f);
+		for (int column = 0; column < 4; column++)
+		{
+			__m128 x = columns[column][0], y = columns[column][1], z = columns[column][2];
+			__m128 w = column == 3 ? one : zero;
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+			_mm_storeu_ps(result[0].Data() + column * 4, x);
+			_mm_storeu_ps(result[1].Data() + column * 4, y);
+			_mm_storeu_ps(result[2].Data() + column * 4, z);
+			_mm_storeu_ps(result[3].Data() + column * 4, w);
+		}
+	}
+#endif
+
+#ifdef GALAXY_SIMD_AVX
+	static void ComposeTRS8(const Utils::AffineMath::TRSBlock& block, const size_t index, Mat4* result)
+	{
+		const __m256 x = _mm256_load_ps(&block.rotation[0][index]);
+		const __m256 y = _mm256_load_ps(&block.rotation[1][index]);
+		const __m256 z = _mm256_load_ps(&block.rotation[2][index]);
+		const __m256 w = _mm256_load_ps(&block.rotation[3][index]);
+		const __m256 one = _mm256_set1_ps(1.f);
+
+		const __m256 xx = _mm256_mul_ps(x, x), yy = _mm256_mul_ps(y, y), zz = _mm256_mul_ps(z, z);
+		const __m256 lengthSquared = _mm256_add_ps(_mm256_add_ps(xx, yy), _mm256_add_ps(zz, _mm256_mul_ps(w, w)));
+		const __m256 nonZero = _mm256_cmp_ps(lengthSquared, _mm256_setzero_ps(), _CMP_NEQ_OQ);
+		const __m256 two = _mm256_and_ps(_mm256_div_ps(_mm256_set1_ps(2.f), lengthSquared), nonZero);
+		const __m256 xy = _mm256_mul_ps(x, y), xz = _mm256_mul_ps(x, z), yz = _mm256_mul_ps(y, z);
+		const __m256 wx = _mm256_mul_ps(w, x), wy = _mm256_mul_ps(w, y), wz = _mm256_mul_ps(w, z);
+
+		const __m256 sx = _mm256_load_ps(&block.scale[0][index]);
+		const __m256 sy = _mm256_load_ps(&block.scale[1][index]);
+		const __m256 sz = _mm256_load_ps(&block.scale[2][index]);
+
+		const __m256 values[4][3] = {
+			{
+				_mm256_mul_ps(_mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(yy, zz))), sx),
+				_mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(xy, wz)), sx),
+				_mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(xz, wy)), sx),
+			},
+			{
+				_mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(xy, wz)), sy),
+				_mm256_mul_ps(_mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(xx, zz))), sy),
+				_mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(yz, wx)), sy),
+			},
+			{
+				_mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(xz, wy)), sz),
+				_mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(yz, wx)), sz),
+				_mm256_mul_ps(_mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(xx, yy))), sz),
+			},
+			{
+				_mm256_load_ps(&block.position[0][index]),
+				_mm256_load_ps(&block.position[1][index]),
+				_mm256_load_ps(&block.position[2][index]),
+			},
+		};
+
+		// Write the 4 first transforms then the 4 last ones
+		__m128 low[4][3];
+		__m128 high[4][3];
+		for (int column = 0; column < 4; column++)
+		{
+			for (int row = 0; row < 3; row++)
+			{
+				low[column][row] = _mm256_castps256_ps128(values[column][row]);
+				high[column][row] = _mm256_extractf128_ps(values[column][row], 1);
+			}
+		}
+		StoreColumns(low, result);
+		StoreColumns(high, result + 4);
+	}
+#endif
+
+#ifdef GALAXY_SIMD_SSE
+	static void ComposeTRS4(const Utils::AffineMath::TRSBlock& block, const size_t index, Mat4* result)
+	{
+		const __m128 x = _mm_load_ps(&block.rotation[0][index]);
+		const __m128 y = _mm_load_ps(&block.rotation[1][index]);
+		const __m128 z = _mm_load_ps(&block.rotation[2][index]);
+		const __m128 w = _mm_load_ps(&block.rotation[3][index]);
+		const __m128 one = _mm_set1_ps(1.f);
+
+		const __m128 xx = _mm_mul_ps(x, x), yy = _mm_mul_ps(y, y), zz = _mm_mul_ps(z, z);
+		const __m128 lengthSquared = _mm_add_ps(_mm_add_ps(xx, yy), _mm_add_ps(zz, _mm_mul_ps(w, w)));
+		const __m128 nonZero = _mm_cmpneq_ps(lengthSquared, _mm_setzero_ps());
+		const __m128 two = _mm_and_ps(_mm_div_ps(_mm_set1_ps(2.f), lengthSquared), nonZero);
+		const __m128 xy = _mm_mul_ps(x, y), xz = _mm_mul_ps(x, z), yz = _mm_mul_ps(y, z);
+		const __m128 wx = _mm_mul_ps(w, x), wy = _mm_mul_ps(w, y), wz = _mm_mul_ps(w, z);
+
+		const __m128 sx = _mm_load_ps(&block.scale[0][index]);
+		const __m128 sy = _mm_load_ps(&block.scale[1][index]);
+		const __m128 sz = _mm_load_ps(&block.scale[2][index]);
+
+		const __m128 columns[4][3] = {
+			{
+				_mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))), sx),
+				_mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xy, wz)), sx),
+				_mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xz, wy)), sx),
+			},
+			{
+				_mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xy, wz)), sy),
+				_mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))), sy),
+				_mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(yz, wx)), sy),
+			},
+			{
+				_mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xz, wy)), sz),
+				_mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(yz, wx)), sz),
+				_mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))), sz),
+			},
+			{
+				_mm_load_ps(&block.position[0][index]),
+				_mm_load_ps(&block.position[1][index]),
+				_mm_load_ps(&block.position[2][index]),
+			},
+		};
+		StoreColumns(columns, result);
+	}
+#endif
+
+	void Utils::AffineMath::ComposeTRS(const TRSBlock& block, const size_t count, Mat4* result)
+	{
+		ASSERT(count <= TRSBlock::capacity);
+		size_t index = 0;
+#ifdef GALAXY_SIMD_AVX
+		for (; index + 8 <= count; index += 8)
+			ComposeTRS8(block, index, result + index);
+#endif
+#ifdef GALAXY_SIMD_SSE
+		for (; index + 4 <= count; index += 4)
+			ComposeTRS4(block, index, result + index);
+#endif
+		for (; index < count; index++)
+			ComposeTRSScalar(block, index, result[index].Data());
+	}
+
+	void Utils::AffineMath::Multiply(const Mat4& parent, const Mat4& local, Mat4& result)
+	{
+#if defined(GALAXY_SIMD_AVX)
+		const float* p = parent.Data();
+		const float* l = local.Data();
+		float* out = result.Data();
+		// Two columns of the result per register
+		const __m256 p0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(p));
+		const __m256 p1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(p + 4));
+		const __m256 p2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(p + 8));
+		const __m256 p3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(p + 12));
+		const __m256 l01 = _mm256_loadu_ps(l);
+		const __m256 l23 = _mm256_loadu_ps(l + 8);
+
+		__m256 r01 = _mm256_mul_ps(p0, _mm256_permute_ps(l01, _MM_SHUFFLE(0, 0, 0, 0)));
+		r01 = _mm256_add_ps(r01, _mm256_mul_ps(p1, _mm256_permute_ps(l01, _MM_SHUFFLE(1, 1, 1, 1))));
+		r01 = _mm256_add_ps(r01, _mm256_mul_ps(p2, _mm256_permute_ps(l01, _MM_SHUFFLE(2, 2, 2, 2))));
+		r01 = _mm256_add_ps(r01, _mm256_mul_ps(p3, _mm256_permute_ps(l01, _MM_SHUFFLE(3, 3, 3, 3))));
+
+		__m256 r23 = _mm256_mul_ps(p0, _mm256_permute_ps(l23, _MM_SHUFFLE(0, 0, 0, 0)));
+		r23 = _mm256_add_ps(r23, _mm256_mul_ps(p1, _mm256_permute_ps(l23, _MM_SHUFFLE(1, 1, 1, 1))));
+		r23 = _mm256_add_ps(r23, _mm256_mul_ps(p2, _mm256_permute_ps(l23, _MM_SHUFFLE(2, 2, 2, 2))));
+		r23 = _mm256_add_ps(r23, _mm256_mul_ps(p3, _mm256_permute_ps(l23, _MM_SHUFFLE(3, 3, 3, 3))));
+
+		_mm256_storeu_ps(out, r01);
+		_mm256_storeu_ps(out + 8, r23);
+#elif defined(GALAXY_SIMD_SSE)
+		const float* p = parent.Data();
+		const float* l = local.Data();
+		float* out = result.Data();
+		const __m128 p0 = _mm_loadu_ps(p);
+		const __m128 p1 = _mm_loadu_ps(p + 4);
+		const __m128 p2 = _mm_loadu_ps(p + 8);
+		const __m128 p3 = _mm_loadu_ps(p + 12);
+
+		// Every column is read before the first write, so the result can be one of the inputs
+		__m128 columns[4];
+		for (int column = 0; column < 4; column++)
+		{
+			const __m128 c = _mm_loadu_ps(l + column * 4);
+			__m128 r = _mm_mul_ps(p0, _mm_shuffle_ps(c, c, _MM_SHUFFLE(0, 0, 0, 0)));
+			r = _mm_add_ps(r, _mm_mul_ps(p1, _mm_shuffle_ps(c, c, _MM_SHUFFLE(1, 1, 1, 1))));
+			r = _mm_add_ps(r, _mm_mul_ps(p2, _mm_shuffle_ps(c, c, _MM_SHUFFLE(2, 2, 2, 2))));
+			columns[column] = _mm_add_ps(r, _mm_mul_ps(p3, _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 3, 3))));
+		}
+		for (int column = 0; column < 4; column++)
+			_mm_storeu_ps(out + column * 4, columns[column]);
+#else
+		Scalar::Multiply(parent, local, result);
+#endif
+	}
+
+	void Utils::AffineMath::ComputeNormalMatrix(const Mat4& model, Mat4& result)
+	{
+#ifdef GALAXY_SIMD_SSE
+		// The columns of the inverse transpose are the cross products of the other columns divided by the determinant
+		const float* m = model.Data();
+		const __m128 c0 = _mm_loadu_ps(m);
+		const __m128 c1 = _mm_loadu_ps(m + 4);
+		const __m128 c2 = _mm_loadu_ps(m + 8);
+		const auto cross = [](const __m128 a, const __m128 b)
+			{
+				const __m128 aYZX = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+				const __m128 bYZX = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+				const __m128 c = _mm_sub_ps(_mm_mul_ps(a, bYZX), _mm_mul_ps(aYZX, b));
+				return _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
+			};
+		const __m128 n0 = cross(c1, c2);
+		const __m128 n1 = cross(c2, c0);
+		const __m128 n2 = cross(c0, c1);
+
+		float determinant[4];
+		_mm_storeu_ps(determinant, _mm_mul_ps(c0, n0));
+		const float det = determinant[0] + determinant[1] + determinant[2];
+		const __m128 inverseDet = _mm_set1_ps(det != 0.f ? 1.f / det : 1.f);
+
+		// The w of the cross products is 0, the normals are not translated
+		float* out = result.Data();
+		_mm_storeu_ps(out, _mm_mul_ps(n0, inverseDet));
+		_mm_storeu_ps(out + 4, _mm_mul_ps(n1, inverseDet));
+		_mm_storeu_ps(out + 8, _mm_mul_ps(n2, inverseDet));
+		_mm_storeu_ps(out + 12, _mm_set_ps(1.f, 0.f, 0.f, 0.f));
+#else
+		Scalar::ComputeNormalMatrix(model, result);
+#endif
+	}
+
+	void Utils::AffineMath::Scalar::ComposeTRS(const TRSBlock& block, const size_t count, Mat4* result)
+	{
+		ASSERT(count <= TRSBlock::capacity);
+		for (size_t index = 0; index < count; index++)
+			ComposeTRSScalar(block, index, result[index].Data());
+	}
+
+	void Utils::AffineMath::Scalar::Multiply(const Mat4& parent, const Mat4& local, Mat4& result)
+	{
+		const float* p = parent.Data();
+		const float* l = local.Data();
+		float columns[16];
+		for (int column = 0; column < 4; column++)
+		{
+			for (int row = 0; row < 4; row++)
+			{
+				columns[column * 4 + row] = p[row] * l[column * 4] + p[4 + row] * l[column * 4 + 1]
+					+ p[8 + row] * l[column * 4 + 2] + p[12 + row] * l[column * 4 + 3];
+			}
+		}
+		std::copy_n(columns, 16, result.Data());
+	}
+
+	void Utils::AffineMath::Scalar::ComputeNormalMatrix(const Mat4& model, Mat4& result)
+	{
+		// The columns of the inverse transpose are the cross products of the other columns divided by the determinant
+		const float* m = model.Data();
+		const Vec3f c0(m[0], m[1], m[2]);
+		const Vec3f c1(m[4], m[5], m[6]);
+		const Vec3f c2(m[8], m[9], m[10]);
+		const auto cross = [](const Vec3f& a, const Vec3f& b)
+			{
+				return Vec3f(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+			};
+		const Vec3f columns[3] = { cross(c1, c2), cross(c2, c0), cross(c0, c1) };
+		const float det = c0.x * columns[0].x + c0.y * columns[0].y + c0.z * columns[0].z;
+		const float inverseDet = det != 0.f ? 1.f / det : 1.f;
+
+		float* out = result.Data();
+		for (int column = 0; column < 3; column++)
+		{
+			out[column * 4] = columns[column].x * inverseDet;
+			out[column * 4 + 1] = columns[column].y * inverseDet;
+			out[column * 4 + 2] = columns[column].z * inverseDet;
+			out[column * 4 + 3] = 0.f;
+		}
+		out[12] = out[13] = out[14] = 0.f;
+		out[15] = 1.f;
+	}
+}
@@ -0,0 +1,68 @@
+#include "pch.h"
+#include "Utils/Arena.h"
+
+namespace GALAXY
+{
+	Utils::Arena::Arena(const size_t blockSize) : m_blockSize(blockSize)
+	{
+	}
+
+	Utils::Arena::~Arena()
+	{
+		ReleaseBlocks();
+	}
+
+	static size_t GetAlignedOffset(const uint8_t* memory, const size_t offset, const size_t alignment)
+	{
+		const uintptr_t address = reinterpret_cast<uintptr_t>(memory) + offset;
+		return offset + ((alignment - address % alignment) % alignment);
+	}
+
+	void* Utils::Arena::Allocate(const size_t size, const size_t alignment)
+	{
+		if (m_blocks.empty() || GetAlignedOffset(m_blocks.back().memory, m_offset, alignment) + size > m_blocks.back().size)
+		{
+			// Worst case padding if the alignment is bigger than the one of the blocks
+			AddBlock(size + alignment);
+			m_offset = 0;
+		}
+
+		const size_t offset = GetAlignedOffset(m_blocks.back().memory, m_offset, alignment);
+		m_offset = offset + size;
+
+		m_used += size;
+		m_peak = std::max(m_peak, m_used);
+		return m_blocks.back().memory + offset;
+	}
+
+	void Utils::Arena::Reset()
+	{
+		if (m_blocks.size() > 1)
+		{
+			const size_t reserved = m_reserved;
+			ReleaseBlocks();
+			AddBlock(reserved);
+		}
+		m_offset = 0;
+		m_used = 0;
+	}
+
+	void Utils::Arena::AddBlock(const size_t minSize)
+	{
+		Block block;
+		block.size = std::max(m_blockSize, minSize);
+		block.memory = static_cast<uint8_t*>(::operator new(block.size, std::align_val_t(alignof(std::max_align_t))));
+		m_blocks.push_back(block);
+		m_reserved += block.size;
+	}
+
+	void Utils::Arena::ReleaseBlocks()
+	{
+		for (const Block& block : m_blocks)
+		{
+			::operator delete(block.memory, std::align_val_t(alignof(std::max_align_t)));
+		}
+		m_blocks.clear();
+		m_reserved = 0;
+	}
+}
@@ -0,0 +1,134 @@
+#include "pch.h"
+#include "Utils/Compression.h"
+
+// Stream of sequences : token (literal length << 4 | match length - 4), literals, 16 bits offset, match
+// Lengths of 15 continue on the next bytes, the last sequence only contains literals
+namespace GALAXY {
+	constexpr size_t minMatch = 4;
+	constexpr size_t maxOffset = 0xFFFF;
+	constexpr uint32_t hashBits = 14;
+	constexpr uint32_t noPosition = UINT32_MAX;
+
+	static void WriteLength(std::vector<uint8_t>& output, size_t length)
+	{
+		while (length >= 0xFF)
+		{
+			output.push_back(0xFF);
+			length -= 0xFF;
+		}
+		output.push_back(static_cast<uint8_t>(length));
+	}
+
+	static bool ReadLength(const uint8_t* data, const size_t size, size_t& position, size_t& length)
+	{
+		uint8_t value;
+		do
+		{
+			if (position >= size)
+				return false;
+			value = data[position++];
+			length += value;
+		} while (value == 0xFF);
+		return true;
+	}
+
+	static void WriteSequence(std::vector<uint8_t>& output, const uint8_t* literals, const size_t literalLength, const size_t offset, const size_t matchLength)
+	{
+		const size_t matchCode = matchLength - minMatch;
+		output.push_back(static_cast<uint8_t>(std::min<size_t>(literalLength, 15) << 4 | std::min<size_t>(matchCode, 15)));
+		if (literalLength >= 15)
+			WriteLength(output, literalLength - 15);
+		output.insert(output.end(), literals, literals + literalLength);
+
+		output.push_back(static_cast<uint8_t>(offset & 0xFF));
+		output.push_back(static_cast<uint8_t>(offset >> 8));
+		if (matchCode >= 15)
+			WriteLength(output, matchCode - 15);
+	}
+
+	std::vector<uint8_t> Utils::Compression::Compress(const uint8_t* data, const size_t size)
+	{
+		std::vector<uint8_t> output;
+		output.reserve(size / 2 + 16);
+
+		std::vector<uint32_t> table(1 << hashBits, noPosition);
+		size_t anchor = 0;
+		size_t position = 0;
+		while (position + minMatch <= size)
+		{
+			uint32_t sequence;
+			std::memcpy(&sequence, data + position, sizeof(uint32_t));
+			const uint32_t hash = (sequence * 2654435761u) >> (32 - hashBits);
+			const uint32_t candidate = table[hash];
+			table[hash] = static_cast<uint32_t>(position);
+
+			if (candidate == noPosition || position - candidate > maxOffset
+				|| std::memcmp(data + candidate, data + position, minMatch) != 0)
+			{
+				position++;
+				continue;
+			}
+
+			size_t matchLength = minMatch;
+			while (position + matchLength < size && data[candidate + matchLength] == data[position + matchLength])
+				matchLength++;
+
+			WriteSequence(output, data + anchor, position - anchor, position - candidate, matchLength);
+			position += matchLength;
+			anchor = position;
+		}
+
+		if (anchor < size)
+		{
+			const size_t literalLength = size - anchor;
+			output.push_back(static_cast<uint8_t>(std::min<size_t>(literalLength, 15) << 4));
+			if (literalLength >= 15)
+				WriteLength(output, literalLength - 15);
+			output.insert(output.end(), data + anchor, data + size);
+		}
+		return output;
+	}
+
+	bool Utils::Compression::Decompress(const uint8_t* data, const size_t size, const size_t rawSize, std::vector<uint8_t>& output)
+	{
+		output.clear();
+		output.reserve(rawSize);
+
+		size_t position = 0;
+		while (output.size() < rawSize)
+		{
+			if (position >= size)
+				return false;
+			const uint8_t token = data[position++];
+
+			size_t literalLength = token >> 4;
+			if (literalLength == 15 && !ReadLength(data, size, position, literalLength))
+				return false;
+			if (position + literalLength > size || output.size() + literalLength > rawSize)
+				return false;
+			output.insert(output.end(), data + position, data + position + literalLength);
+			position += literalLength;
+
+			// The last sequence has no match
+			if (output.size() == rawSize)
+				break;
+
+			if (position + 2 > size)
+				return false;
+			const size_t offset = data[position] | data[position + 1] << 8;
+			position += 2;
+			size_t matchLength = token & 0xF;
+			if (matchLength == 15 && !ReadLength(data, size, position, matchLength))
+				return false;
+			matchLength += minMatch;
+
+			if (offset == 0 || offset > output.size() || output.size() + matchLength > rawSize)
+				return false;
+			// The match can overlap the bytes it writes, copy one by one
+			size_t source = output.size() - offset;
+			for (size_t i = 0; i < matchLength; i++)
+				output.push_back(output[source++]);
+		}
+		return position == size;
+	}
+}
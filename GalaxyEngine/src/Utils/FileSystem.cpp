@@ -1,6 +1,12 @@
 #include "pch.h"
 #include "Utils/FileSystem.h"
 
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
 namespace GALAXY {
 	std::fstream Utils::FileSystem::OpenFile(const std::filesystem::path& path)
 	{
@@ -43,6 +49,47 @@ namespace GALAXY {
 		return outputFile;
 	}
 
+	bool Utils::FileSystem::WriteFileAtomic(const std::filesystem::path& path, const std::string& content)
+	{
+		std::filesystem::path tempPath = path;
+		tempPath += ".tmp";
+
+#ifdef _WIN32
+		FILE* file = _wfopen(tempPath.c_str(), L"wb");
+#else
+		FILE* file = std::fopen(tempPath.c_str(), "wb");
+#endif
+		if (!file) {
+			PrintError("Failed to create the file %s", tempPath.string().c_str());
+			return false;
+		}
+
+		// Flush to the disk before the rename, otherwise a crash could leave an empty scene behind
+		bool success = std::fwrite(content.data(), 1, content.size(), file) == content.size();
+		success &= std::fflush(file) == 0;
+#ifdef _WIN32
+		success &= _commit(_fileno(file)) == 0;
+#else
+		success &= fsync(fileno(file)) == 0;
+#endif
+		success &= std::fclose(file) == 0;
+
+		std::error_code ec;
+		if (!success) {
+			PrintError("Failed to write the file %s", tempPath.string().c_str());
+			std::filesystem::remove(tempPath, ec);
+			return false;
+		}
+
+		std::filesystem::rename(tempPath, path, ec);
+		if (ec) {
+			PrintError("Failed to replace file %s, err : %s", path.string().c_str(), ec.message().c_str());
+			std::filesystem::remove(tempPath, ec);
+			return false;
+		}
+		return true;
+	}
+
 #ifndef _WIN32
 #include <sys/stat.h>
 #endif
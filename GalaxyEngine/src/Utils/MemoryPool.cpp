@@ -0,0 +1,146 @@
+#include "pch.h"
+#include "Utils/MemoryPool.h"
+
+namespace GALAXY
+{
+	constexpr size_t slabSize = 64 * 1024;
+	// Blocks moved between a thread cache and its class at once
+	constexpr uint32_t batchSize = 32;
+	constexpr uint32_t maxCachedBlocks = batchSize * 2;
+
+	static std::atomic_size_t s_largeCount = 0;
+
+	struct Utils::MemoryPool::ThreadCache
+	{
+		void* heads[classCount] = {};
+		uint32_t counts[classCount] = {};
+
+		~ThreadCache()
+		{
+			for (size_t i = 0; i < classCount; i++)
+			{
+				if (counts[i] > 0)
+					Drain(*this, i, counts[i]);
+			}
+		}
+	};
+
+	Utils::MemoryPool::ThreadCache& Utils::MemoryPool::GetThreadCache()
+	{
+		thread_local ThreadCache cache;
+		return cache;
+	}
+
+	static void*& Next(void* block)
+	{
+		return *static_cast<void**>(block);
+	}
+
+	void* Utils::MemoryPool::Allocate(const size_t size)
+	{
+		const size_t classIndex = GetClassIndex(size);
+		if (classIndex == classCount)
+		{
+			s_largeCount.fetch_add(1, std::memory_order_relaxed);
+			return ::operator new(size);
+		}
+
+		ThreadCache& cache = GetThreadCache();
+		if (!cache.heads[classIndex])
+			Refill(cache, classIndex);
+
+		void* block = cache.heads[classIndex];
+		cache.heads[classIndex] = Next(block);
+		cache.counts[classIndex]--;
+		GetClasses()[classIndex].used.fetch_add(1, std::memory_order_relaxed);
+		return block;
+	}
+
+	void Utils::MemoryPool::Free(void* pointer, const size_t size)
+	{
+		if (!pointer)
+			return;
+		const size_t classIndex = GetClassIndex(size);
+		if (classIndex == classCount)
+		{
+			s_largeCount.fetch_sub(1, std::memory_order_relaxed);
+			::operator delete(pointer);
+			return;
+		}
+
+		ThreadCache& cache = GetThreadCache();
+		Next(pointer) = cache.heads[classIndex];
+		cache.heads[classIndex] = pointer;
+		GetClasses()[classIndex].used.fetch_sub(1, std::memory_order_relaxed);
+		if (++cache.counts[classIndex] > maxCachedBlocks)
+			Drain(cache, classIndex, batchSize);
+	}
+
+	void Utils::MemoryPool::Refill(ThreadCache& cache, const size_t classIndex)
+	{
+		SizeClass& sizeClass = GetClasses()[classIndex];
+		const size_t blockSize = classSizes[classIndex];
+
+		std::lock_guard lock(sizeClass.mutex);
+		if (!sizeClass.freeList)
+		{
+			uint8_t* slab = static_cast<uint8_t*>(::operator new(slabSize));
+			sizeClass.slabs.push_back(slab);
+			sizeClass.reserved.fetch_add(slabSize, std::memory_order_relaxed);
+			for (size_t offset = slabSize / blockSize * blockSize; offset > 0; offset -= blockSize)
+			{
+				void* block = slab + offset - blockSize;
+				Next(block) = sizeClass.freeList;
+				sizeClass.freeList = block;
+			}
+		}
+
+		for (uint32_t i = 0; i < batchSize && sizeClass.freeList; i++)
+		{
+			void* block = sizeClass.freeList;
+			sizeClass.freeList = Next(block);
+			Next(block) = cache.heads[classIndex];
+			cache.heads[classIndex] = block;
+			cache.counts[classIndex]++;
+		}
+	}
+
+	void Utils::MemoryPool::Drain(ThreadCache& cache, const size_t classIndex, const uint32_t count)
+	{
+		SizeClass& sizeClass = GetClasses()[classIndex];
+
+		std::lock_guard lock(sizeClass.mutex);
+		for (uint32_t i = 0; i < count && cache.heads[classIndex]; i++)
+		{
+			void* block = cache.heads[classIndex];
+			cache.heads[classIndex] = Next(block);
+			cache.counts[classIndex]--;
+			Next(block) = sizeClass.freeList;
+			sizeClass.freeList = block;
+		}
+	}
+
+	Utils::MemoryPool::SizeClass* Utils::MemoryPool::GetClasses()
+	{
+		// Never destroyed, objects can be freed by static destructors and thread exits
+		static SizeClass* classes = new SizeClass[classCount];
+		return classes;
+	}
+
+	List<Utils::MemoryPool::Stats> Utils::MemoryPool::GetStats()
+	{
+		List<Stats> stats(classCount);
+		for (size_t i = 0; i < classCount; i++)
+		{
+			stats[i].size = classSizes[i];
+			stats[i].used = GetClasses()[i].used.load(std::memory_order_relaxed);
+			stats[i].reserved = GetClasses()[i].reserved.load(std::memory_order_relaxed);
+		}
+		return stats;
+	}
+
+	size_t Utils::MemoryPool::GetLargeCount()
+	{
+		return s_largeCount.load(std::memory_order_relaxed);
+	}
+}
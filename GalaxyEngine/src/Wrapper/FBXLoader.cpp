@@ -309,6 +309,7 @@ namespace GALAXY
 			allPositions.push_back(positions);
 
 			mesh->m_finalVertices = finalVertices;
+			mesh->BuildTriangleBVH();
 
 			mesh->p_shouldBeLoaded = true;
 			mesh->p_loaded = true;
@@ -318,7 +319,7 @@ namespace GALAXY
 			mesh->m_model = outputModel;
 
 			auto bind = [outputModel] { outputModel->OnMeshLoaded(); };
-			mesh->OnLoad.Bind(bind);
+			outputModel->m_meshLoadSubscriptions.push_back(mesh->OnLoad.Subscribe(bind));
 
 			mesh->SendRequest();
 		}
@@ -36,6 +36,7 @@ void Wrapper::OBJLoader::Load(const std::filesystem::path& fullPath, Resource::M
 		positionVertices[i] = model.m_meshes[i].positions;
 		mesh->m_indices = model.m_meshes[i].indices;
 		mesh->m_finalVertices = model.m_meshes[i].finalVertices;
+		mesh->BuildTriangleBVH();
 		for (size_t j = 0; j < model.m_meshes[i].subMeshes.size(); j++) {
 			Resource::SubMesh subMesh;
 			subMesh.startIndex = model.m_meshes[i].subMeshes[j].startIndex;
@@ -57,7 +58,7 @@ void Wrapper::OBJLoader::Load(const std::filesystem::path& fullPath, Resource::M
 		mesh->m_model = outputModel;
 
 		auto bind = [outputModel] { outputModel->OnMeshLoaded(); };
-		mesh->OnLoad.Bind(bind);
+		outputModel->m_meshLoadSubscriptions.push_back(mesh->OnLoad.Subscribe(bind));
 
 		mesh->SendRequest();
 	}
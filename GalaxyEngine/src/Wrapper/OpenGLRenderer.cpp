@@ -642,17 +642,6 @@ namespace GALAXY
 		glDepthRange(static_cast<double>(_near), static_cast<double>(_far));
 	}
 
-	Vec4f Wrapper::OpenGLRenderer::ReadPixelColor(const Vec2f& mousePos)
-	{
-		unsigned char data[4];
-		glFlush();
-		glFinish();
-
-		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-		glReadPixels(static_cast<GLint>(mousePos.x), static_cast<GLint>(mousePos.y), 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, data);
-		return Vec4f(data[0], data[1], data[2], data[3]);
-	}
-
 	void Wrapper::OpenGLRenderer::ReadPixels(const Vec2i& size, unsigned char*& data)
 	{
 		glReadPixels(0, 0, size.x, size.y, GL_RGBA, GL_UNSIGNED_BYTE, data);
@@ -51,6 +51,13 @@ add_requires("miniaudio")
 -- enable features 
 add_defines("ENABLE_MULTI_THREAD")
 
+-- CPU features
+option("avx2")
+    set_default(false)
+    set_showmenu(true)
+    set_description("Build the transform, culling and occlusion kernels with AVX2, the CPU running the engine must support it")
+option_end()
+
 set_languages("c++20")
 
 set_rundir("GalaxyCore")
@@ -68,6 +75,11 @@ target("GalaxyEngine")
     add_includedirs("GalaxyEngine/include")
 
     add_defines("GALAXY_EXPORTS")
+
+    add_options("avx2")
+    if (has_config("avx2")) then
+        add_vectorexts("avx2")
+    end
     
     if (is_plat("windows", "msvc")) then 
         add_cxflags("/permissive")